@@ -5,6 +5,7 @@ set(PCSX2_DEFS "")
 # Misc option
 #-------------------------------------------------------------------------------
 option(LIBRETRO "Enables building the libretro core" ON)
+option(BUILD_GSRUNNER "Build the headless GS dump player" OFF)
 set(CMAKE_BUILD_PO FALSE)
 set(USE_SYSTEM_LIBS OFF)
 add_definitions(-D__LIBRETRO__)
@@ -154,6 +154,42 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_cdvd_cache_size",
+      "System > Compressed Disc Cache Size (Restart)",
+      "Compressed Disc Cache Size (Restart)",
+      "Amount of decompressed data kept in memory for CHD, CSO/ZSO and gzipped disc images. A larger cache avoids decompressing the same data again when a game seeks back and forth.",
+      NULL,
+      "system",
+      {
+         { "1", "1 MB" },
+         { "4", "4 MB" },
+         { "8", "8 MB" },
+         { "16", "16 MB" },
+         { "32", "32 MB" },
+         { "64", "64 MB" },
+         { NULL, NULL },
+      },
+      "4"
+   },
+   {
+      "pcsx2_cdvd_read_ahead",
+      "System > Compressed Disc Read-Ahead (Restart)",
+      "Compressed Disc Read-Ahead (Restart)",
+      "Amount of data decompressed in the background ahead of sequential reads from CHD, CSO/ZSO and gzipped disc images. Raise this if streamed audio or video stutters when the image is on slow or network storage. Limited to half of the cache size.",
+      NULL,
+      "system",
+      {
+         { "128", "128 KB" },
+         { "256", "256 KB" },
+         { "512", "512 KB" },
+         { "1024", "1 MB" },
+         { "2048", "2 MB" },
+         { "4096", "4 MB" },
+         { NULL, NULL },
+      },
+      "512"
+   },
    {
       "pcsx2_enable_cheats",
       "System > Enable Cheats",
@@ -182,6 +218,84 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_gs_dump",
+      "System > Record GS Dump",
+      "Record GS Dump",
+      "Records the GS input of the next frames to the 'pcsx2/gsdumps' directory in the system folder, for replaying with the GS runner. Select a frame count to start a new recording.",
+      NULL,
+      "system",
+      {
+         { "disabled", NULL },
+         { "1 frame", NULL },
+         { "10 frames", NULL },
+         { "60 frames", NULL },
+         { "300 frames", NULL },
+         { "1800 frames", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_delta_savestates",
+      "System > Delta Savestates",
+      "Delta Savestates",
+      "For same-instance run-ahead and rewind, only save and restore the memory written since the last state, and only store the pages which changed since an in-memory keyframe. 'Run-Ahead and Rewind' keeps older keyframes around so the frontend can rewind through them, up to the memory set below. Save states made by the user are always full states.",
+      NULL,
+      "system",
+      {
+         { "disabled", NULL },
+         { "runahead", "Run-Ahead" },
+         { "rewind", "Run-Ahead and Rewind" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_delta_rewind_memory",
+      "System > Delta Savestate Rewind Memory",
+      "Delta Savestate Rewind Memory",
+      "Memory used for the keyframes which rewinding through delta savestates needs. Once it's full, the oldest keyframe is dropped and rewinding can't go back past the next one. Each keyframe is as large as a full savestate.",
+      NULL,
+      "system",
+      {
+         { "512 MB", NULL },
+         { "1024 MB", NULL },
+         { "2048 MB", NULL },
+         { "4096 MB", NULL },
+         { NULL, NULL },
+      },
+      "1024 MB"
+   },
+   {
+      "pcsx2_mtgs_stats",
+      "System > GS Ring Statistics",
+      "GS Ring Statistics",
+      "Reports how full the queue between the emulated CPU and the GS thread gets, how often either side waited on the other and how many packets went through it, once a second. 'Log' writes the full counters to the log, 'On-Screen' shows a summary as a notification.",
+      NULL,
+      "system",
+      {
+         { "disabled", NULL },
+         { "log", "Log" },
+         { "osd", "On-Screen" },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
+   {
+      "pcsx2_iop_block_profile",
+      "System > IOP Block Profiling (Restart)",
+      "IOP Block Profiling (Restart)",
+      "Counts how often each block of recompiled IOP code runs. When the IOP recompiler is reset or the content is closed, the log gets the busiest IOP modules and blocks. Slows the IOP down a little, so leave it disabled unless looking for IOP hot spots.",
+      NULL,
+      "system",
+      {
+         { "enabled", NULL },
+         { "disabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "pcsx2_renderer",
       "Video > Renderer",
@@ -501,6 +615,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "enabled"
    },
+   {
+      "pcsx2_sw_work_stealing",
+      "Video > Work Stealing Rasterizer (Software)",
+      "Work Stealing Rasterizer (Software)",
+      "Splits the screen into bands which idle rasterizer threads pick up as they go, instead of giving each thread a fixed set of bands. Helps when most of the drawing happens in one part of the screen.",
+      NULL,
+      "video",
+      {
+         { "disabled", NULL },
+         { "enabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
 #if 0
    {
       "pcsx2_sw_renderer_threads",
@@ -560,6 +688,20 @@ struct retro_core_option_v2_definition option_defs_us[] = {
       },
       "disabled"
    },
+   {
+      "pcsx2_ipu_thread",
+      "Emulation > Threaded IPU Decoding",
+      "Threaded IPU Decoding",
+      "Runs the IDCT and colour conversion stages of FMV decoding on a helper thread while the EE keeps running. Can help FMVs reach full speed on CPUs with few cores.",
+      NULL,
+      "emulation",
+      {
+         { "disabled", NULL },
+         { "enabled", NULL },
+         { NULL, NULL },
+      },
+      "disabled"
+   },
    {
       "pcsx2_game_enhancements_hint",
       "Emulation > Game Enhancements hint (Restart)",
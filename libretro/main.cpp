@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <thread>
 #include <atomic>
+#include <ctime>
 
 #include "libretro_core_options.h"
 
@@ -20,11 +21,13 @@
 #include "../pcsx2/CDVD/CDVD.h"
 #include "../pcsx2/MTVU.h"
 #include "../pcsx2/Counters.h"
+#include "../pcsx2/Gif_Unit.h"
 #include "../pcsx2/Host.h"
 
 #include "../common/Path.h"
 #include "../common/FileSystem.h"
 #include "../common/MemorySettingsInterface.h"
+#include "../common/Timer.h"
 
 #include "../pcsx2/GS/Renderers/Common/GSRenderer.h"
 #ifdef ENABLE_VULKAN
@@ -40,6 +43,7 @@
 #include "../pcsx2/Frontend/LayeredSettingsInterface.h"
 #include "../pcsx2/VMManager.h"
 #include "../pcsx2/Patch.h"
+#include "../pcsx2/SaveStateDelta.h"
 
 #include "../pcsx2/SPU2/spu2.h"
 #include "../pcsx2/PAD/PAD.h"
@@ -75,14 +79,15 @@ static struct retro_perf_callback perf_cb;
 retro_environment_t environ_cb;
 retro_video_refresh_t video_cb;
 retro_log_printf_t log_cb;
-retro_audio_sample_t sample_cb;
+retro_audio_sample_batch_t batch_cb;
 struct retro_hw_render_callback hw_render;
 
 MemorySettingsInterface s_settings_interface;
 
-static retro_audio_sample_batch_t batch_cb;
+static retro_audio_sample_t sample_cb;
 
 static std::atomic<VMState> cpu_thread_state;
+static size_t serialize_size;
 static std::thread cpu_thread;
 
 static freezeData fd = {};
@@ -103,6 +108,8 @@ struct BiosInfo
 };
 
 static std::vector<BiosInfo> bios_info;
+static std::string current_game_serial;
+static u32 current_game_crc                    = 0;
 static std::string setting_bios;
 static std::string setting_renderer;
 static int setting_upscale_multiplier          = 1;
@@ -133,12 +140,18 @@ s8 setting_hint_widescreen                     = 0;
 static s8 setting_hint_game_enhancements       = 0;
 static s8 setting_hint_uncapped_framerate      = 0;
 static s8 internal_setting_region              = RETRO_REGION_NTSC;
+static u32 setting_gs_dump_frames              = 0;
+static u8 setting_delta_savestates             = 0;
+static u32 setting_delta_rewind_mb             = 1024;
+static u8 setting_mtgs_stats                   = 0;
 static s8 setting_trilinear_filtering          = 0;
 static bool setting_hint_nointerlacing         = false;
 static bool setting_pcrtc_antiblur             = false;
 static bool setting_enable_cheats              = false;
 static bool setting_enable_hw_hacks            = false;
 static bool setting_auto_flush_software        = false;
+static bool setting_sw_work_stealing           = false;
+static bool setting_ipu_thread                 = false;
 static bool setting_disable_depth_conversion   = false;
 static bool setting_framebuffer_conversion     = false;
 static bool setting_disable_partial_invalid    = false;
@@ -249,6 +262,8 @@ static bool update_option_visibility(void)
 		option_display.visible = setting_show_gsdx_sw_only_options;
 		option_display.key     = "pcsx2_auto_flush_software";
 		environ_cb(RETRO_ENVIRONMENT_SET_CORE_OPTIONS_DISPLAY, &option_display);
+		option_display.key     = "pcsx2_sw_work_stealing";
+		environ_cb(RETRO_ENVIRONMENT_SET_CORE_OPTIONS_DISPLAY, &option_display);
 
 		updated                = true;
 	}
@@ -332,6 +347,18 @@ static void cpu_thread_pause(void)
 		MTGS::MainLoop(true);
 }
 
+static void queue_gs_dump(u32 frames)
+{
+	char filename[256];
+	const std::string dump_dir = Path::Combine(EmuFolders::DataRoot, "gsdumps");
+	if (!path_is_valid(dump_dir.c_str()))
+		path_mkdir(dump_dir.c_str());
+
+	snprintf(filename, sizeof(filename), "%s_%lld.gs",
+		current_game_serial.empty() ? "unknown" : current_game_serial.c_str(), (long long)time(nullptr));
+	GSQueueDump(Path::Combine(dump_dir, filename), current_game_serial, current_game_crc, frames);
+}
+
 static void check_variables(bool first_run)
 {
 	struct retro_variable var;
@@ -371,6 +398,21 @@ static void check_variables(bool first_run)
 			bool fast_cdvd = !strcmp(var.value, "enabled");
 			s_settings_interface.SetBoolValue("EmuCore/Speedhacks", "fastCDVD", fast_cdvd);
 		}
+
+		var.key = "pcsx2_iop_block_profile";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool iop_block_profile = !strcmp(var.value, "enabled");
+			s_settings_interface.SetBoolValue("EmuCore/CPU/Recompiler", "ProfileIOPBlocks", iop_block_profile);
+		}
+
+		var.key = "pcsx2_cdvd_cache_size";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+			s_settings_interface.SetUIntValue("EmuCore", "CdvdCacheSize", strtoul(var.value, nullptr, 10));
+
+		var.key = "pcsx2_cdvd_read_ahead";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+			s_settings_interface.SetUIntValue("EmuCore", "CdvdReadAhead", strtoul(var.value, nullptr, 10));
 	}
 
 	if (setting_plugin_type == PLUGIN_PGS)
@@ -964,6 +1006,19 @@ static void check_variables(bool first_run)
 				updated = true;
 			}
 		}
+
+		var.key = "pcsx2_sw_work_stealing";
+		if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		{
+			bool sw_work_stealing_prev = setting_sw_work_stealing;
+			setting_sw_work_stealing = !strcmp(var.value, "enabled");
+
+			if (first_run || setting_sw_work_stealing != sw_work_stealing_prev)
+			{
+				s_settings_interface.SetBoolValue("EmuCore/GS", "sw_work_stealing", setting_sw_work_stealing);
+				updated = true;
+			}
+		}
 	}
 
 	if (setting_plugin_type == PLUGIN_GSDX_HW || setting_plugin_type == PLUGIN_GSDX_SW)
@@ -1011,6 +1066,62 @@ static void check_variables(bool first_run)
 			setting_hint_language_unlock = 0;
 	}
 
+	var.key = "pcsx2_gs_dump";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		u32 gs_dump_frames_prev = setting_gs_dump_frames;
+		/* "disabled" parses as 0 */
+		setting_gs_dump_frames  = strtoul(var.value, nullptr, 10);
+
+		if (!first_run && setting_gs_dump_frames != 0 && setting_gs_dump_frames != gs_dump_frames_prev)
+			queue_gs_dump(setting_gs_dump_frames);
+	}
+
+	var.key = "pcsx2_delta_savestates";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		u8 delta_savestates_prev = setting_delta_savestates;
+		if (!strcmp(var.value, "runahead"))
+			setting_delta_savestates = 1;
+		else if (!strcmp(var.value, "rewind"))
+			setting_delta_savestates = 2;
+		else
+			setting_delta_savestates = 0;
+
+		/* Drop the keyframes and stop write tracking, nothing will use them anymore */
+		if (!first_run && setting_delta_savestates == 0 && delta_savestates_prev != 0)
+		{
+			cpu_thread_pause();
+			SaveStateDelta::Reset();
+			VMManager::SetPaused(false);
+		}
+	}
+
+	var.key = "pcsx2_delta_rewind_memory";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+		setting_delta_rewind_mb = strtoul(var.value, nullptr, 10);
+
+	SaveStateDelta::SetRewindBudget(setting_delta_savestates == 2 ? static_cast<size_t>(setting_delta_rewind_mb) * _1mb : 0);
+
+	var.key = "pcsx2_mtgs_stats";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		u8 mtgs_stats_prev = setting_mtgs_stats;
+		if (!strcmp(var.value, "log"))
+			setting_mtgs_stats = 1;
+		else if (!strcmp(var.value, "osd"))
+			setting_mtgs_stats = 2;
+		else
+			setting_mtgs_stats = 0;
+
+		if (first_run || setting_mtgs_stats != mtgs_stats_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/GS", "LogMTGSStats", setting_mtgs_stats == 1);
+			MTGS::ResetRingStats();
+			updated = true;
+		}
+	}
+
 	var.key = "pcsx2_ee_cycle_rate";
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
 	{
@@ -1108,6 +1219,19 @@ static void check_variables(bool first_run)
 		}
 	}
 
+	var.key = "pcsx2_ipu_thread";
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		bool ipu_thread_prev = setting_ipu_thread;
+		setting_ipu_thread = !strcmp(var.value, "enabled");
+
+		if (first_run || setting_ipu_thread != ipu_thread_prev)
+		{
+			s_settings_interface.SetBoolValue("EmuCore/Speedhacks", "ipuThread", setting_ipu_thread);
+			updated = true;
+		}
+	}
+
 	char input_settings[32];
 	for (int i = 0; i < 2; ++i)
 	{
@@ -1605,7 +1729,8 @@ static void cpu_thread_entry(VMBootParameters boot_params)
 	VMManager::Initialize(boot_params);
 	VMManager::SetState(VMState::Running);
 
-	while (VMManager::GetState() != VMState::Shutdown)
+	VMState state;
+	while ((state = VMManager::GetState()) != VMState::Shutdown)
 	{
 		if (VMManager::HasValidVM())
 		{
@@ -1634,11 +1759,20 @@ static void cpu_thread_entry(VMBootParameters boot_params)
 						return;
 
 					case VMState::Paused:
+						// Parked until SetState() moves us on, cpu_thread_pause() has seen Paused by now.
+						VMManager::WaitWhileState(VMState::Paused);
+						continue;
+
 					default:
 						continue;
 				}
 			}
 		}
+		else
+		{
+			// Still initialising or stopping, sleep until that changes.
+			VMManager::WaitWhileState(state);
+		}
 	}
 }
 
@@ -1901,11 +2035,47 @@ void retro_unload_game(void)
 #endif
 	VMManager::Internal::CPUThreadShutdown();
 
+	serialize_size = 0;
+	SaveStateDelta::Reset();
+
 	((LayeredSettingsInterface*)Host::GetSettingsInterface())->SetLayer(LayeredSettingsInterface::LAYER_BASE, nullptr);
 
 	retro_set_region(RETRO_REGION_NTSC); /* set back to default */
 }
 
+/* Puts the MTGS ring counters up as a notification once a second. */
+static void show_mtgs_stats(void)
+{
+	const MTGS_RingStats stats = MTGS::GetRingStats();
+	if (Common::Timer::ConvertValueToSeconds(stats.ticks) < 1.0)
+		return;
+	MTGS::ResetRingStats();
+
+	u64 wait_calls = 0;
+	u64 wait_ticks = 0;
+	for (int i = 0; i < static_cast<int>(MTGS_WaitReason::Count); i++)
+	{
+		wait_calls += stats.wait_calls[i];
+		wait_ticks += stats.wait_ticks[i];
+	}
+
+	char msg[128];
+	snprintf(msg, sizeof(msg), "GS ring: %u/%u peak, %llu stalls (%.1f ms), %llu waits (%.1f ms)",
+		stats.high_water, stats.ring_size,
+		static_cast<unsigned long long>(stats.queue_stalls), Common::Timer::ConvertValueToSeconds(stats.queue_stall_ticks) * 1e3,
+		static_cast<unsigned long long>(wait_calls), Common::Timer::ConvertValueToSeconds(wait_ticks) * 1e3);
+
+	struct retro_message_ext message;
+	message.msg      = msg;
+	message.duration = 1000;
+	message.priority = 1;
+	message.level    = RETRO_LOG_INFO;
+	message.target   = RETRO_MESSAGE_TARGET_OSD;
+	message.type     = RETRO_MESSAGE_TYPE_STATUS;
+	message.progress = -1;
+	environ_cb(RETRO_ENVIRONMENT_SET_MESSAGE_EXT, &message);
+}
+
 void retro_run(void)
 {
 	bool updated = false;
@@ -1925,6 +2095,11 @@ void retro_run(void)
 
 	MTGS::MainLoop(false);
 
+	if (setting_mtgs_stats == 2)
+		show_mtgs_stats();
+
+	SPU2::FlushOutput();
+
 	RETRO_PERFORMANCE_STOP(pcsx2_run);
 }
 
@@ -1936,133 +2111,159 @@ std::optional<WindowInfo> Host::AcquireRenderWindow(void)
 	return wi;
 }
 
-size_t retro_serialize_size(void)
+static void freeze_component(SaveStateBase& state, FreezeAction action, s32 (*freeze)(FreezeAction, freezeData*))
 {
 	freezeData fP = {0, nullptr};
+	freeze(FreezeAction::Size, &fP);
+	state.PrepBlock(fP.size);
+	if (!state.IsOkay())
+		return;
+
+	/* Sizing walks have no backing store to freeze into. */
+	if (action != FreezeAction::Size)
+	{
+		fP.data = state.GetBlockPtr();
+		freeze(action, &fP);
+	}
+	state.CommitBlock(fP.size);
+}
+
+static bool freeze_state(SaveStateBase& state, FreezeAction action)
+{
+	state.FreezeBios();
+	state.FreezeInternals();
+
+	SaveStateDelta::FreezeTracked(state, SaveStateDelta::TRACK_EE_RAM, eeMem->Main, sizeof(eeMem->Main));
+	SaveStateDelta::FreezeTracked(state, SaveStateDelta::TRACK_IOP_RAM, iopMem->Main, sizeof(iopMem->Main));
+	state.FreezeMem(eeHw, sizeof(eeHw));
+	state.FreezeMem(iopHw, sizeof(iopHw));
+	state.FreezeMem(eeMem->Scratch, sizeof(eeMem->Scratch));
+	state.FreezeMem(vuRegs[0].Mem, VU0_MEMSIZE);
+	state.FreezeMem(vuRegs[1].Mem, VU1_MEMSIZE);
+	state.FreezeMem(vuRegs[0].Micro, VU0_PROGSIZE);
+	state.FreezeMem(vuRegs[1].Micro, VU1_PROGSIZE);
+
+	freeze_component(state, action, SPU2freeze);
+	freeze_component(state, action, PADfreeze);
+	freeze_component(state, action, GSfreeze);
+
+	return state.IsOkay();
+}
+
+/* The SIO FIFOs and the GIF path buffers change size at runtime.
+ * Frontends cache the serialize size, so leave room for all of them
+ * to be full on top of the size measured now. */
+static constexpr size_t SERIALIZE_SIO_FIFO_SLACK = 2 * _1kb;
+
+static size_t serialize_gif_path_slack(void)
+{
+	size_t slack = 0;
+	for (const Gif_Path& path : gifUnit.gifPath)
+		slack += path.buffSize - path.curSize;
+	return slack;
+}
+
+size_t retro_serialize_size(void)
+{
+	if (serialize_size == 0)
+	{
+		/* Nothing to size before content is running, and pausing would never finish. */
+		if (!VMManager::HasValidVM())
+			return 0;
+
+		memSizingState sizer;
+		const bool was_paused = (VMManager::GetState() == VMState::Paused);
+
+		cpu_thread_pause();
+		freeze_state(sizer, FreezeAction::Size);
+		if (!was_paused)
+			VMManager::SetPaused(false);
+
+		serialize_size = sizer.GetSize() + SERIALIZE_SIO_FIFO_SLACK + serialize_gif_path_slack() +
+						 SaveStateDelta::HEADER_RESERVE;
+	}
 
-	size_t size   = _8mb;
-	size         += Ps2MemSize::MainRam;
-	size         += Ps2MemSize::IopRam;
-	size         += Ps2MemSize::Hardware;
-	size         += Ps2MemSize::IopHardware;
-	size         += Ps2MemSize::Scratch;
-	size         += VU0_MEMSIZE;
-	size         += VU1_MEMSIZE;
-	size         += VU0_PROGSIZE;
-	size         += VU1_PROGSIZE;
-	SPU2freeze(FreezeAction::Size, &fP);
-	size         += fP.size;
-	PADfreeze(FreezeAction::Size, &fP);
-	size         += fP.size;
-	GSfreeze(FreezeAction::Size, &fP);
-	size         += fP.size;
-
-	return size;
+	return serialize_size;
+}
+
+static bool use_delta_savestate(void)
+{
+	int context = RETRO_SAVESTATE_CONTEXT_NORMAL;
+
+	if (setting_delta_savestates == 0)
+		return false;
+	if (!environ_cb(RETRO_ENVIRONMENT_GET_SAVESTATE_CONTEXT, &context))
+		context = RETRO_SAVESTATE_CONTEXT_NORMAL;
+
+	/* Deltas need this instance's keyframes, never hand them to another
+	 * one, and never to the user: those states have to outlive content. */
+	return (context == RETRO_SAVESTATE_CONTEXT_RUNAHEAD_SAME_INSTANCE);
+}
+
+static bool save_state(SaveStateBase& state)
+{
+	return freeze_state(state, FreezeAction::Save);
+}
+
+static bool load_state(SaveStateBase& state)
+{
+	return freeze_state(state, FreezeAction::Load);
 }
 
 bool retro_serialize(void* data, size_t size)
 {
-	freezeData fP;
-	std::vector<u8> buffer;
+	size_t written = 0;
+	bool delta = use_delta_savestate();
+	bool okay;
 
 	cpu_thread_pause();
 
-	memSavingState saveme(buffer);
-
-	saveme.FreezeBios();
-	saveme.FreezeInternals();
-
-	saveme.FreezeMem(eeMem->Main, sizeof(eeMem->Main));
-	saveme.FreezeMem(iopMem->Main, sizeof(iopMem->Main));
-	saveme.FreezeMem(eeHw, sizeof(eeHw));
-	saveme.FreezeMem(iopHw, sizeof(iopHw));
-	saveme.FreezeMem(eeMem->Scratch, sizeof(eeMem->Scratch));
-	saveme.FreezeMem(vuRegs[0].Mem, VU0_MEMSIZE);
-	saveme.FreezeMem(vuRegs[1].Mem, VU1_MEMSIZE);
-	saveme.FreezeMem(vuRegs[0].Micro, VU0_PROGSIZE);
-	saveme.FreezeMem(vuRegs[1].Micro, VU1_PROGSIZE);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	SPU2freeze(FreezeAction::Size, &fP);
-	saveme.PrepBlock(fP.size);
-	fP.data = saveme.GetBlockPtr();
-	SPU2freeze(FreezeAction::Save, &fP);
-	saveme.CommitBlock(fP.size);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	PADfreeze(FreezeAction::Size, &fP);
-	saveme.PrepBlock(fP.size);
-	fP.data = saveme.GetBlockPtr();
-	PADfreeze(FreezeAction::Save, &fP);
-	saveme.CommitBlock(fP.size);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	GSfreeze(FreezeAction::Size, &fP);
-	saveme.PrepBlock(fP.size);
-	fP.data = saveme.GetBlockPtr();
-	GSfreeze(FreezeAction::Save, &fP);
-	saveme.CommitBlock(fP.size);
-
-	memcpy(data, buffer.data(), buffer.size());
+	if (delta)
+		okay = SaveStateDelta::Save(save_state, data, size, &written);
+	else
+	{
+		memSpanSavingState saveme(data, size);
+		okay    = freeze_state(saveme, FreezeAction::Save);
+		written = saveme.GetSize();
+	}
 
 	VMManager::SetPaused(false);
+
+	if (!okay)
+	{
+		log_cb(RETRO_LOG_ERROR, "Savestate does not fit in %zu bytes\n", size);
+		return false;
+	}
+
+	/* Keep the unused tail of full states deterministic for netplay
+	 * diffing. Deltas carry their own size, and clearing the whole
+	 * buffer every run-ahead frame would cost more than the delta. */
+	if (!delta)
+		memset(static_cast<u8*>(data) + written, 0, size - written);
 	return true;
 }
 
 bool retro_unserialize(const void* data, size_t size)
 {
-	freezeData fP;
-	std::vector<u8> buffer;
+	bool okay;
 
 	cpu_thread_pause();
 
-	buffer.reserve(size);
-	memcpy(buffer.data(), data, size);
-	memLoadingState loadme(buffer);
-
-	loadme.FreezeBios();
-	loadme.FreezeInternals();
-
 	VMManager::Internal::ClearCPUExecutionCaches();
-	loadme.FreezeMem(eeMem->Main, sizeof(eeMem->Main));
-	loadme.FreezeMem(iopMem->Main, sizeof(iopMem->Main));
-	loadme.FreezeMem(eeHw, sizeof(eeHw));
-	loadme.FreezeMem(iopHw, sizeof(iopHw));
-	loadme.FreezeMem(eeMem->Scratch, sizeof(eeMem->Scratch));
-	loadme.FreezeMem(vuRegs[0].Mem, VU0_MEMSIZE);
-	loadme.FreezeMem(vuRegs[1].Mem, VU1_MEMSIZE);
-	loadme.FreezeMem(vuRegs[0].Micro, VU0_PROGSIZE);
-	loadme.FreezeMem(vuRegs[1].Micro, VU1_PROGSIZE);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	SPU2freeze(FreezeAction::Size, &fP);
-	loadme.PrepBlock(fP.size);
-	fP.data = loadme.GetBlockPtr();
-	SPU2freeze(FreezeAction::Load, &fP);
-	loadme.CommitBlock(fP.size);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	PADfreeze(FreezeAction::Size, &fP);
-	loadme.PrepBlock(fP.size);
-	fP.data = loadme.GetBlockPtr();
-	PADfreeze(FreezeAction::Load, &fP);
-	loadme.CommitBlock(fP.size);
-
-	fP.size = 0;
-	fP.data = nullptr;
-	GSfreeze(FreezeAction::Size, &fP);
-	loadme.PrepBlock(fP.size);
-	fP.data = loadme.GetBlockPtr();
-	GSfreeze(FreezeAction::Load, &fP);
-	loadme.CommitBlock(fP.size);
+
+	if (SaveStateDelta::IsDelta(data, size))
+		okay = SaveStateDelta::Load(data, size, load_state);
+	else
+	{
+		memSpanLoadingState loadme(data, size);
+		okay = freeze_state(loadme, FreezeAction::Load);
+	}
 
 	VMManager::SetPaused(false);
-	return true;
+
+	if (!okay)
+		log_cb(RETRO_LOG_ERROR, "Failed to load savestate\n");
+	return okay;
 }
 
 size_t retro_get_memory_size(unsigned id)
@@ -2102,6 +2303,17 @@ std::optional<std::string> Host::ReadResourceFileToString(const char* filename)
 	return ret;
 }
 
+bool Host::ResourceFileExists(const char* filename)
+{
+	const std::string path(Path::Combine(EmuFolders::Resources, filename));
+	return path_is_valid(path.c_str());
+}
+
+std::string Host::GetResourceFilePath(const char* filename)
+{
+	return Path::Combine(EmuFolders::Resources, filename);
+}
+
 int lrps2_ingame_patches(const char *serial,
 		u32 game_crc,
 		const char *renderer,
@@ -2120,6 +2332,9 @@ void Host::OnGameChanged(const std::string& disc_path,
 	const char *serial = game_serial.c_str();
 	log_cb(RETRO_LOG_INFO, "serial: %s\n", serial);
 
+	current_game_serial = game_serial;
+	current_game_crc    = game_crc;
+
 	ret = lrps2_ingame_patches(game_serial.c_str(),
 			game_crc,
 			setting_renderer.c_str(),
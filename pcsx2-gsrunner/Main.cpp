@@ -0,0 +1,333 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Headless GS dump player. Feeds a recorded GS dump through the software, null or
+// hardware renderer (on a null device) as fast as possible and reports throughput, so
+// the GS front end can be benchmarked without booting a game or having a GPU. Also packs
+// texture replacement directories and benchmarks the interpreted VIF unpacks.
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <libretro.h>
+
+#include "common/AlignedMalloc.h"
+#include "common/Timer.h"
+#include "common/WindowInfo.h"
+
+#include "pcsx2/Config.h"
+#include "pcsx2/Host.h"
+#include "pcsx2/VMManager.h"
+#include "pcsx2/GS/GS.h"
+#include "pcsx2/GS/GSDump.h"
+#include "pcsx2/GS/MultiISA.h"
+#include "pcsx2/GS/Renderers/Common/GSRenderer.h"
+#include "pcsx2/GS/Renderers/HW/GSTextureReplacements.h"
+#include "pcsx2/GS/Renderers/Null/GSDeviceNull.h"
+#include "pcsx2/GS/Renderers/Null/GSRendererNull.h"
+
+#include "VifUnpackBench.h"
+
+// Normally provided by the libretro frontend glue.
+static void RETRO_CALLCONV gsrunner_log(enum retro_log_level level, const char* fmt, ...)
+{
+	std::va_list ap;
+	va_start(ap, fmt);
+	std::vfprintf(stderr, fmt, ap);
+	va_end(ap);
+}
+
+retro_environment_t environ_cb;
+retro_video_refresh_t video_cb;
+retro_log_printf_t log_cb = gsrunner_log;
+retro_audio_sample_batch_t batch_cb;
+struct retro_hw_render_callback hw_render;
+s8 setting_hint_widescreen = 0;
+
+std::optional<WindowInfo> Host::AcquireRenderWindow(void)
+{
+	return std::nullopt;
+}
+
+std::optional<std::vector<u8>> Host::ReadResourceFile(const char* filename)
+{
+	return std::nullopt;
+}
+
+std::optional<std::string> Host::ReadResourceFileToString(const char* filename)
+{
+	return std::nullopt;
+}
+
+bool Host::ResourceFileExists(const char* filename)
+{
+	return false;
+}
+
+std::string Host::GetResourceFilePath(const char* filename)
+{
+	return {};
+}
+
+void Host::OnGameChanged(const std::string& disc_path, const std::string& elf_override,
+	const std::string& game_serial, u32 game_crc)
+{
+}
+
+enum class RunnerRenderer
+{
+	SW,
+	Null,
+	HW
+};
+
+static const char* s_renderer_names[] = {"sw", "null", "hw"};
+
+struct RunnerOptions
+{
+	std::string filename;
+	std::string pack_source;
+	bool vif_bench = false;
+	RunnerRenderer renderer = RunnerRenderer::SW;
+	int threads = 2;
+	int loops = 1;
+};
+
+static void PrintUsage(const char* progname)
+{
+	std::fprintf(stderr,
+		"Usage: %s [options] <dump.gs>\n"
+		"       %s -packtextures <replacement dir> <output.pack>\n"
+		"       %s -vifbench [-loop <n>]\n"
+		"  -renderer <sw|null|hw>  Renderer to replay through, hw runs on a null device (default: sw)\n"
+		"  -threads <n>            Software renderer extra threads (default: 2)\n"
+		"  -loop <n>               Number of times to replay the dump (default: 1)\n",
+		progname, progname, progname);
+}
+
+static bool ParseCommandLine(int argc, char* argv[], RunnerOptions& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const bool has_value = (i + 1) < argc;
+		if (!std::strcmp(arg, "-renderer") && has_value)
+		{
+			const char* value = argv[++i];
+			if (!std::strcmp(value, "sw"))
+				options.renderer = RunnerRenderer::SW;
+			else if (!std::strcmp(value, "null"))
+				options.renderer = RunnerRenderer::Null;
+			else if (!std::strcmp(value, "hw"))
+				options.renderer = RunnerRenderer::HW;
+			else
+			{
+				std::fprintf(stderr, "Unknown renderer '%s'\n", value);
+				return false;
+			}
+		}
+		else if (!std::strcmp(arg, "-threads") && has_value)
+			options.threads = std::atoi(argv[++i]);
+		else if (!std::strcmp(arg, "-loop") && has_value)
+			options.loops = std::max(std::atoi(argv[++i]), 1);
+		else if (!std::strcmp(arg, "-packtextures") && has_value)
+			options.pack_source = argv[++i];
+		else if (!std::strcmp(arg, "-vifbench"))
+			options.vif_bench = true;
+		else if (arg[0] == '-')
+			return false;
+		else
+			options.filename = arg;
+	}
+
+	return options.vif_bench || !options.filename.empty();
+}
+
+static void ReplayDump(const GSDump::File& dump, u8* regs, std::vector<u8>& fifo_buffer)
+{
+	for (const GSDump::Packet& packet : dump.packets)
+	{
+		const u8* data = dump.GetPacketData(packet);
+		switch (packet.type)
+		{
+			case GSDump::PacketType::Transfer:
+				g_gs_renderer->Transfer(data, packet.size / 16);
+				break;
+
+			case GSDump::PacketType::VSync:
+				g_gs_renderer->Flush(GSState::VSYNC);
+				g_gs_renderer->VSync(data[0], data[1] != 0, g_gs_renderer->IsIdleFrame());
+				break;
+
+			case GSDump::PacketType::ReadFIFO:
+			{
+				u32 qwc;
+				std::memcpy(&qwc, data, sizeof(qwc));
+				if (fifo_buffer.size() < qwc * 16)
+					fifo_buffer.resize(qwc * 16);
+				g_gs_renderer->InitReadFIFO(fifo_buffer.data(), qwc);
+				g_gs_renderer->ReadFIFO(fifo_buffer.data(), qwc);
+			}
+			break;
+
+			case GSDump::PacketType::Registers:
+				std::memcpy(regs, data, std::min<u32>(packet.size, Ps2MemSize::GSregs));
+				break;
+
+			case GSDump::PacketType::SoftReset:
+			{
+				u32 mask;
+				std::memcpy(&mask, data, sizeof(mask));
+				g_gs_renderer->SoftReset(mask);
+			}
+			break;
+
+			default:
+				break;
+		}
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	RunnerOptions options;
+	if (!ParseCommandLine(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if (options.vif_bench)
+		return RunVifUnpackBench(options.loops);
+
+	if (!options.pack_source.empty())
+	{
+		// The output path takes the place of the dump.
+		return GSTextureReplacements::BuildReplacementPack(options.pack_source, options.filename) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	GSDump::File dump;
+	std::string error;
+	if (!dump.Load(options.filename.c_str(), &error))
+	{
+		std::fprintf(stderr, "Failed to load '%s': %s\n", options.filename.c_str(), error.c_str());
+		return EXIT_FAILURE;
+	}
+	if (dump.state_version != GSState::STATE_VERSION)
+	{
+		std::fprintf(stderr, "Dump was recorded with GS state version %u, this build uses %u\n",
+			dump.state_version, GSState::STATE_VERSION);
+		return EXIT_FAILURE;
+	}
+
+	std::fprintf(stderr, "Loaded '%s': serial '%s', CRC %08X, %u frames, %zu packets\n",
+		options.filename.c_str(), dump.serial.c_str(), dump.crc, dump.frame_count, dump.packets.size());
+
+	cpuinfo_initialize();
+	GSinit();
+
+	GSConfig.Renderer = GSRendererType::SW;
+	GSConfig.SWExtraThreads = static_cast<u16>(std::max(options.threads, 0));
+
+	u8* regs = static_cast<u8*>(_aligned_malloc(Ps2MemSize::GSregs, 32));
+	std::vector<u8> fifo_buffer;
+
+	if (options.renderer == RunnerRenderer::HW)
+	{
+		// Goes through the usual open, so the renderer is set up like it is in the core.
+		GSopen(GSConfig, GSRendererType::Null, RETRO_HW_CONTEXT_NONE, regs);
+		if (!g_gs_renderer)
+		{
+			std::fprintf(stderr, "Failed to open the hardware renderer\n");
+			_aligned_free(regs);
+			GSshutdown();
+			return EXIT_FAILURE;
+		}
+	}
+	else
+	{
+		if (options.renderer == RunnerRenderer::SW)
+			g_gs_renderer = std::unique_ptr<GSRenderer>(MULTI_ISA_SELECT(makeGSRendererSW)(GSConfig.SWExtraThreads));
+		else
+			g_gs_renderer = std::make_unique<GSRendererNull>();
+
+		g_gs_renderer->SetRegsMem(regs);
+		g_gs_renderer->ResetPCRTC();
+	}
+
+	u32 total_frames = 0;
+	u64 total_draws = 0;
+	const u64 start_time = Common::Timer::GetCurrentValue();
+
+	for (int loop = 0; loop < options.loops; loop++)
+	{
+		// Every pass starts from the recorded state, so passes are identical.
+		std::memcpy(regs, dump.regs.data(), std::min<size_t>(dump.regs.size(), Ps2MemSize::GSregs));
+		freezeData fd = {static_cast<int>(dump.state.size()), const_cast<u8*>(dump.state.data())};
+		if (g_gs_renderer->Defrost(&fd) != 0)
+		{
+			std::fprintf(stderr, "Failed to load the GS state from the dump\n");
+			break;
+		}
+
+		const int draws_before = GSState::s_n;
+		ReplayDump(dump, regs, fifo_buffer);
+		total_draws += static_cast<u64>(GSState::s_n - draws_before);
+		total_frames += dump.frame_count;
+	}
+
+	const double seconds = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start_time);
+
+	GSDeviceNull::Counters device_counters = {};
+	if (options.renderer == RunnerRenderer::HW)
+	{
+		device_counters = GSDeviceNull::GetInstance()->GetTotalCounters();
+		GSclose();
+	}
+	else
+	{
+		g_gs_renderer->Destroy();
+		g_gs_renderer.reset();
+	}
+	_aligned_free(regs);
+	GSshutdown();
+
+	std::fprintf(stdout, "Renderer: %s\n", s_renderer_names[static_cast<int>(options.renderer)]);
+	std::fprintf(stdout, "Frames: %u, draws: %llu, time: %.3f s\n", total_frames,
+		static_cast<unsigned long long>(total_draws), seconds);
+	if (seconds > 0.0)
+	{
+		std::fprintf(stdout, "Frames/sec: %.2f\n", total_frames / seconds);
+		std::fprintf(stdout, "Draws/sec: %.2f\n", total_draws / seconds);
+	}
+	if (options.renderer == RunnerRenderer::HW && device_counters.frames > 0)
+	{
+		const double frames = static_cast<double>(device_counters.frames);
+		std::fprintf(stdout, "Per frame: %.1f draws, %.1f textures created (%.1f KB), %.1f uploads, %.1f copies, %.1f readbacks\n",
+			device_counters.draws / frames, device_counters.textures_created / frames,
+			device_counters.texture_bytes / frames / 1024.0, device_counters.uploads / frames,
+			device_counters.copies / frames, device_counters.readbacks / frames);
+	}
+
+	return EXIT_SUCCESS;
+}
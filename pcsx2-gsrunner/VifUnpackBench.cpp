@@ -0,0 +1,217 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Checks the interpreted VIF unpack (_nVifUnpack) against the scalar VIFfuncTable
+// reference (_nVifUnpackScalar), then times both. Runs on VIF0 with its own VU memory,
+// nothing else of the VM is needed.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "common/AlignedMalloc.h"
+#include "common/Timer.h"
+
+#include "pcsx2/Common.h"
+#include "pcsx2/Vif.h"
+#include "pcsx2/Vif_Dma.h"
+#include "pcsx2/Vif_Dynarec.h"
+#include "pcsx2/VU.h"
+
+#include "VifUnpackBench.h"
+
+namespace
+{
+	struct UnpackCase
+	{
+		const char* name;
+		u8 upk;   // VN/VL bits of the UNPACK command
+		bool mask;
+		u8 mode;
+		u8 cl, wl;
+	};
+
+	// Run the way most games send them, CL=WL=1.
+	static constexpr UnpackCase s_timed_cases[] = {
+		{"V4-32", 0xc, false, 0, 1, 1},
+		{"V4-16", 0xd, false, 0, 1, 1},
+		{"V3-32", 0x8, false, 0, 1, 1},
+		{"V2-16", 0x5, false, 0, 1, 1},
+		{"S-32", 0x0, false, 0, 1, 1},
+		{"V4-8 masked", 0xe, true, 0, 1, 1},
+		{"V4-32 mode 1", 0xc, false, 1, 1, 1},
+		{"V3-16 mode 2 masked", 0x9, true, 2, 1, 1},
+		{"V4-5", 0xf, false, 0, 1, 1},
+	};
+
+	static constexpr u8 s_upk_types[] = {0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xa, 0xc, 0xd, 0xe, 0xf};
+	static constexpr u8 s_cycles[][2] = {{1, 1}, {4, 4}, {2, 4}, {1, 3}, {4, 2}, {3, 1}};
+
+	static constexpr u32 VU0_MEM_SIZE = 0x1000;
+	static constexpr u32 DATA_SIZE = 256 * 16 + 64; // num can be 256, V3 reads a word past each vector
+
+	struct BenchState
+	{
+		u32 seed = 0x12345678;
+		u8* ref_mem;
+		u8* test_mem;
+		u8* data;
+		u32 row[4];
+		u32 col[4];
+		u32 mask;
+	};
+
+	static u32 Random(BenchState& state)
+	{
+		state.seed ^= state.seed << 13;
+		state.seed ^= state.seed >> 17;
+		state.seed ^= state.seed << 5;
+		return state.seed;
+	}
+
+	static bool IsFill(const UnpackCase& c)
+	{
+		return c.cl < c.wl;
+	}
+
+	static void SetupUnpack(const BenchState& state, const UnpackCase& c, bool usn, u32 num, u32 addr)
+	{
+		vif0.cmd = 0x60 | c.upk | (c.mask ? 0x10 : 0);
+		vif0.usn = usn;
+		vif0.tag.addr = addr;
+		vif0.cl = 0;
+		std::memcpy(&vif0.MaskRow, state.row, sizeof(state.row));
+		std::memcpy(&vif0.MaskCol, state.col, sizeof(state.col));
+		vif0Regs.num = num;
+		vif0Regs.mode = c.mode;
+		vif0Regs.mask = state.mask;
+		vif0Regs.cycle.cl = c.cl;
+		vif0Regs.cycle.wl = c.wl;
+	}
+
+	// Runs one unpack through both paths from the same state and memory, returns true if they agree.
+	static bool CompareUnpack(BenchState& state, const UnpackCase& c, bool usn, u32 num, u32 addr)
+	{
+		for (u32 i = 0; i < VU0_MEM_SIZE; i++)
+			state.ref_mem[i] = static_cast<u8>(Random(state));
+		std::memcpy(state.test_mem, state.ref_mem, VU0_MEM_SIZE);
+
+		vuRegs[0].Mem = state.ref_mem;
+		SetupUnpack(state, c, usn, num, addr);
+		_nVifUnpackScalar(0, state.data, c.mode, IsFill(c));
+		const u32 ref_addr = vif0.tag.addr;
+		const int ref_cl = vif0.cl;
+		const u32 ref_num = vif0Regs.num;
+		u32 ref_row[4];
+		std::memcpy(ref_row, &vif0.MaskRow, sizeof(ref_row));
+
+		vuRegs[0].Mem = state.test_mem;
+		SetupUnpack(state, c, usn, num, addr);
+		_nVifUnpack(0, state.data, c.mode, IsFill(c));
+
+		return std::memcmp(state.ref_mem, state.test_mem, VU0_MEM_SIZE) == 0 && vif0.tag.addr == ref_addr &&
+			   vif0.cl == ref_cl && vif0Regs.num == ref_num && std::memcmp(&vif0.MaskRow, ref_row, sizeof(ref_row)) == 0;
+	}
+
+	static u32 Validate(BenchState& state)
+	{
+		u32 cases = 0;
+		u32 failures = 0;
+		for (const u8 upk : s_upk_types)
+		{
+			for (int usn = 0; usn < 2; usn++)
+			{
+				for (int mask = 0; mask < 2; mask++)
+				{
+					for (u8 mode = 0; mode < 4; mode++)
+					{
+						for (const auto& cycle : s_cycles)
+						{
+							const UnpackCase c = {"", upk, mask != 0, mode, cycle[0], cycle[1]};
+							for (u32 i = 0; i < DATA_SIZE; i++)
+								state.data[i] = static_cast<u8>(Random(state));
+							for (int i = 0; i < 4; i++)
+							{
+								state.row[i] = Random(state);
+								state.col[i] = Random(state);
+							}
+							state.mask = Random(state);
+
+							// Start close to the end of VU memory so runs wrap, as they do when this path is taken.
+							const u32 num = (Random(state) & 0xff) + 1;
+							const u32 addr = (VU0_MEM_SIZE - 16 * (Random(state) & 0x3f) - 16) & 0xff0;
+							if (!CompareUnpack(state, c, usn != 0, num, addr))
+							{
+								std::fprintf(stderr, "Mismatch: unpack %x usn %d mask %d mode %u CL %u WL %u num %u addr %x\n",
+									upk, usn, mask, mode, cycle[0], cycle[1], num, addr);
+								failures++;
+							}
+							cases++;
+						}
+					}
+				}
+			}
+		}
+
+		std::fprintf(stdout, "Validated %u unpacks against the scalar reference, %u mismatches\n", cases, failures);
+		return failures;
+	}
+
+	template <typename Fn>
+	static double TimeUnpack(BenchState& state, const UnpackCase& c, int iterations, Fn&& unpack)
+	{
+		static constexpr u32 NUM = 256;
+		const u64 start = Common::Timer::GetCurrentValue();
+		for (int i = 0; i < iterations; i++)
+		{
+			SetupUnpack(state, c, false, NUM, 0);
+			unpack(0, state.data, c.mode, IsFill(c));
+		}
+		const double seconds = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start);
+		return seconds * 1e9 / (static_cast<double>(iterations) * NUM);
+	}
+} // namespace
+
+int RunVifUnpackBench(int loops)
+{
+	BenchState state;
+	state.ref_mem = static_cast<u8*>(_aligned_malloc(VU0_MEM_SIZE, 16));
+	state.test_mem = static_cast<u8*>(_aligned_malloc(VU0_MEM_SIZE, 16));
+	state.data = static_cast<u8*>(_aligned_malloc(DATA_SIZE, 16));
+	u8* const saved_mem = vuRegs[0].Mem;
+
+	const u32 failures = Validate(state);
+
+	const int iterations = 2000 * loops;
+	for (u32 i = 0; i < DATA_SIZE; i++)
+		state.data[i] = static_cast<u8>(Random(state));
+	state.mask = 0x1b1b1b1b; // a bit of each of data, row, column and write protect
+	vuRegs[0].Mem = state.test_mem;
+
+	std::fprintf(stdout, "256-vector runs, ns per vector:\n");
+	std::fprintf(stdout, "  %-22s %10s %10s\n", "", "scalar", "vector");
+	for (const UnpackCase& c : s_timed_cases)
+	{
+		const double scalar = TimeUnpack(state, c, iterations, _nVifUnpackScalar);
+		const double vector = TimeUnpack(state, c, iterations, _nVifUnpack);
+		std::fprintf(stdout, "  %-22s %10.1f %10.1f\n", c.name, scalar, vector);
+	}
+
+	vuRegs[0].Mem = saved_mem;
+	_aligned_free(state.data);
+	_aligned_free(state.test_mem);
+	_aligned_free(state.ref_mem);
+	return (failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
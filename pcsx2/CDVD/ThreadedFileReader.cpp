@@ -18,14 +18,26 @@
 
 #include "ThreadedFileReader.h"
 
+#include "../../common/Console.h"
 #include "../../common/Threading.h"
+#include "../../common/Timer.h"
+
+#include "../Config.h"
 
 // Make sure buffer size is bigger than the cutoff where PCSX2 emulates a seek
 // If buffers are smaller than that, we can't keep up with linear reads
 static constexpr u32 MINIMUM_SIZE = 128 * 1024;
 
+// Bounds for EmuConfig.CdvdCacheSize, in MB
+static constexpr u32 MINIMUM_CACHE_SIZE = 1;
+static constexpr u32 MAXIMUM_CACHE_SIZE = 64;
+
+// Number of back-to-back requests before a stream of reads counts as sequential
+static constexpr u32 SEQUENTIAL_THRESHOLD = 2;
+
 ThreadedFileReader::ThreadedFileReader()
 {
+	ResizeCache();
 	m_readThread = std::thread([](ThreadedFileReader* r){ r->Loop(); }, this);
 }
 
@@ -35,9 +47,108 @@ ThreadedFileReader::~ThreadedFileReader()
 	(void)std::lock_guard<std::mutex>{m_mtx};
 	m_condition.notify_one();
 	m_readThread.join();
-	for (auto& buffer : m_buffer)
-		if (buffer.ptr)
-			free(buffer.ptr);
+	for (u32 i = 0; i < m_bufferCount; i++)
+		if (m_buffer[i].ptr)
+			free(m_buffer[i].ptr);
+}
+
+void ThreadedFileReader::ResizeCache()
+{
+	const u32 cacheSize = std::clamp<u32>(EmuConfig.CdvdCacheSize, MINIMUM_CACHE_SIZE, MAXIMUM_CACHE_SIZE);
+	const u32 count = std::max<u32>(cacheSize * _1mb / MINIMUM_SIZE, 4);
+
+	if (count != m_bufferCount)
+	{
+		for (u32 i = 0; i < m_bufferCount; i++)
+			if (m_buffer[i].ptr)
+				free(m_buffer[i].ptr);
+		m_buffer = std::make_unique<Buffer[]>(count);
+		m_bufferCount = count;
+	}
+	else
+	{
+		for (u32 i = 0; i < m_bufferCount; i++)
+			m_buffer[i].size.store(0, std::memory_order_relaxed);
+	}
+
+	// Never read ahead so far that the data being read ahead evicts itself
+	m_readAhead = std::min<u32>(EmuConfig.CdvdReadAhead * _1kb, (count / 2) * MINIMUM_SIZE);
+	m_lastRequestEnd = 0;
+	m_sequentialRun = 0;
+}
+
+void ThreadedFileReader::NoteRequest(u64 offset, u32 size)
+{
+	if (offset == m_lastRequestEnd)
+		m_sequentialRun = std::min(m_sequentialRun + 1, SEQUENTIAL_THRESHOLD);
+	else
+		m_sequentialRun = 0;
+	m_lastRequestEnd = offset + size;
+	m_stats.reads.fetch_add(1, std::memory_order_relaxed);
+}
+
+u32 ThreadedFileReader::WantedReadAhead() const
+{
+	// Random access only gets the rest of the current block and the next one, like it always did
+	if (m_sequentialRun >= SEQUENTIAL_THRESHOLD)
+		return std::max(m_readAhead, MINIMUM_SIZE);
+	return MINIMUM_SIZE;
+}
+
+u64 ThreadedFileReader::CachedBytesFrom(u64 offset, u64 limit) const
+{
+	// Buffers aren't kept in order, so keep going until no buffer continues the run
+	u64 end = offset;
+	bool progress = true;
+	while (progress && end - offset < limit)
+	{
+		progress = false;
+		for (u32 i = 0; i < m_bufferCount; i++)
+		{
+			const Buffer& buf = m_buffer[i];
+			u32 bufsize = buf.size.load(std::memory_order_acquire);
+			if (bufsize && buf.offset <= end && buf.offset + bufsize > end)
+			{
+				end = buf.offset + bufsize;
+				progress = true;
+			}
+		}
+	}
+	return end - offset;
+}
+
+ThreadedFileReader::Stats ThreadedFileReader::GetStats() const
+{
+	Stats stats;
+	stats.reads = m_stats.reads.load(std::memory_order_relaxed);
+	stats.hits = m_stats.hits.load(std::memory_order_relaxed);
+	stats.stalls = m_stats.stalls.load(std::memory_order_relaxed);
+	stats.stallTicks = m_stats.stallTicks.load(std::memory_order_relaxed);
+	stats.readAheadBytes = m_stats.readAheadBytes.load(std::memory_order_relaxed);
+	stats.evictions = m_stats.evictions.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void ThreadedFileReader::LogStats()
+{
+	const Stats stats = GetStats();
+	if (stats.reads == 0)
+		return;
+
+	Console.WriteLn("(CDVD) %llu reads, %.1f%% from cache, %llu stalled (%.1f ms total), %llu KB read ahead, %llu evictions",
+		static_cast<unsigned long long>(stats.reads),
+		static_cast<double>(stats.hits) * 100.0 / static_cast<double>(stats.reads),
+		static_cast<unsigned long long>(stats.stalls),
+		Common::Timer::ConvertValueToSeconds(stats.stallTicks) * 1e3,
+		static_cast<unsigned long long>(stats.readAheadBytes / _1kb),
+		static_cast<unsigned long long>(stats.evictions));
+
+	m_stats.reads.store(0, std::memory_order_relaxed);
+	m_stats.hits.store(0, std::memory_order_relaxed);
+	m_stats.stalls.store(0, std::memory_order_relaxed);
+	m_stats.stallTicks.store(0, std::memory_order_relaxed);
+	m_stats.readAheadBytes.store(0, std::memory_order_relaxed);
+	m_stats.evictions.store(0, std::memory_order_relaxed);
 }
 
 void ThreadedFileReader::Loop()
@@ -54,6 +165,7 @@ void ThreadedFileReader::Loop()
 
 		u64 requestOffset;
 		u32 requestSize;
+		u32 readAhead;
 
 		bool ok = true;
 		m_running = true;
@@ -63,6 +175,7 @@ void ThreadedFileReader::Loop()
 			void* ptr     = m_requestPtr.load(std::memory_order_acquire);
 			requestOffset = m_requestOffset;
 			requestSize   = m_requestSize;
+			readAhead     = WantedReadAhead();
 			lock.unlock();
 
 			if (ptr)
@@ -84,24 +197,34 @@ void ThreadedFileReader::Loop()
 		if (ok)
 		{
 			// Readahead
+			const u64 readAheadEnd = requestOffset + requestSize + readAhead;
+			// Don't go through so many buffers that we start evicting what we just read ahead
+			const u32 maxBuffers = std::max<u32>(m_bufferCount / 2, 2);
 			Chunk chunk = ChunkForOffset(requestOffset + requestSize);
 			if (chunk.chunkID >= 0)
 			{
-				int buffersFilled = 0;
-				Buffer* buf = GetBlockPtr(chunk);
+				u32 buffersFilled = 0;
+				bool loaded = false;
+				Buffer* buf = GetBlockPtr(chunk, &loaded);
+				if (buf && loaded)
+					m_stats.readAheadBytes.fetch_add(buf->size.load(std::memory_order_relaxed), std::memory_order_relaxed);
 				// Cancel readahead if a new request comes in
 				while (buf && !m_requestPtr.load(std::memory_order_acquire))
 				{
 					u32 bufsize = buf->size.load(std::memory_order_relaxed);
+					if (buf->offset + bufsize >= readAheadEnd)
+						break;
 					chunk = ChunkForOffset(buf->offset + bufsize);
 					if (chunk.chunkID < 0)
 						break;
 					if (buf->offset + bufsize != chunk.offset || chunk.length + bufsize > buf->cap)
 					{
 						buffersFilled++;
-						if (buffersFilled >= 2)
+						if (buffersFilled >= maxBuffers)
 							break;
-						buf = GetBlockPtr(chunk);
+						buf = GetBlockPtr(chunk, &loaded);
+						if (buf && loaded)
+							m_stats.readAheadBytes.fetch_add(buf->size.load(std::memory_order_relaxed), std::memory_order_relaxed);
 					}
 					else
 					{
@@ -109,6 +232,7 @@ void ThreadedFileReader::Loop()
 						if (amt <= 0)
 							break;
 						buf->size.store(bufsize + amt, std::memory_order_release);
+						m_stats.readAheadBytes.fetch_add(amt, std::memory_order_relaxed);
 					}
 				}
 			}
@@ -124,20 +248,42 @@ void ThreadedFileReader::Loop()
 	}
 }
 
-ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
+ThreadedFileReader::Buffer& ThreadedFileReader::GetEvictionCandidate()
+{
+	u32 oldest = 0;
+	u64 oldestUse = UINT64_MAX;
+	for (u32 i = 0; i < m_bufferCount; i++)
+	{
+		if (!m_buffer[i].size.load(std::memory_order_relaxed))
+			return m_buffer[i];
+		u64 lastUse = m_buffer[i].lastUse.load(std::memory_order_relaxed);
+		if (lastUse < oldestUse)
+		{
+			oldest = i;
+			oldestUse = lastUse;
+		}
+	}
+	m_stats.evictions.fetch_add(1, std::memory_order_relaxed);
+	return m_buffer[oldest];
+}
+
+ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block, bool* loaded)
 {
-	for (int i = 0; i < static_cast<int>(std::size(m_buffer)); i++)
+	if (loaded)
+		*loaded = false;
+
+	for (u32 i = 0; i < m_bufferCount; i++)
 	{
 		u32 size = m_buffer[i].size.load(std::memory_order_relaxed);
 		u64 offset = m_buffer[i].offset;
 		if (size && offset <= block.offset && offset + size >= block.offset + block.length)
 		{
-			m_nextBuffer = (i + 1) % std::size(m_buffer);
-			return m_buffer + i;
+			m_buffer[i].lastUse.store(++m_useCounter, std::memory_order_relaxed);
+			return &m_buffer[i];
 		}
 	}
 
-	Buffer& buf = m_buffer[m_nextBuffer];
+	Buffer& buf = GetEvictionCandidate();
 	{
 		// This can be called from both the read thread threads in ReadSync
 		// Calls from ReadSync are done with the lock already held to keep the read thread out
@@ -158,7 +304,9 @@ ThreadedFileReader::Buffer* ThreadedFileReader::GetBlockPtr(const Chunk& block)
 	{
 		buf.offset = block.offset;
 		buf.size.store(size, std::memory_order_release);
-		m_nextBuffer = (m_nextBuffer + 1) % std::size(m_buffer);
+		buf.lastUse.store(++m_useCounter, std::memory_order_relaxed);
+		if (loaded)
+			*loaded = true;
 		return &buf;
 	}
 	return nullptr;
@@ -235,74 +383,61 @@ bool ThreadedFileReader::Decompress(void* target, u64 begin, u32 size)
 
 bool ThreadedFileReader::TryCachedRead(void*& buffer, u64& offset, u32& size, const std::lock_guard<std::mutex>&)
 {
-	// Run through twice so that if m_buffer[1] contains the first half and m_buffer[0] contains the second half it still works
-	m_amtRead    = 0;
-	u64 end      = 0;
-	bool allDone = false;
-	if (m_internalBlockSize)
+	// Keep passing over the buffers while they make progress, since the one holding the start of the request
+	// can come after the one holding the rest of it
+	m_amtRead     = 0;
+	bool progress = true;
+	while (size > 0 && progress)
 	{
-		for (int i = 0; i < static_cast<int>(std::size(m_buffer) * 2); i++)
+		progress = false;
+		for (u32 i = 0; i < m_bufferCount && size > 0; i++)
 		{
-			Buffer& buf = m_buffer[i % std::size(m_buffer)];
+			Buffer& buf = m_buffer[i];
 			u32 bufsize = buf.size.load(std::memory_order_acquire);
-			if (!bufsize)
+			if (!bufsize || buf.offset > offset || buf.offset + bufsize <= offset)
 				continue;
-			if (buf.offset <= offset && buf.offset + bufsize > offset)
+
+			size_t read;
+			u32 off     = offset - buf.offset;
+			u32 cpysize = std::min(size, bufsize - off);
+			if (m_internalBlockSize)
 			{
-				size_t read;
-				u32 off          = offset - buf.offset;
-				u32 cpysize      = std::min(size, bufsize - off);
 				char* cdst       = static_cast<char*>(buffer);
 				const char* csrc = static_cast<const char*>(static_cast<char*>(buf.ptr) + off);
 				const char* cend = csrc + cpysize;
 				for (; csrc < cend; csrc += m_internalBlockSize, cdst += m_blocksize)
 					memcpy(cdst, csrc, m_blocksize);
 				read = cdst - static_cast<char*>(buffer);
-				m_amtRead   += read;
-				size        -= cpysize;
-				offset      += cpysize;
-				buffer       = static_cast<char*>(buffer) + read;
-				if (size == 0)
-					end  = buf.offset + bufsize;
 			}
-			// Do buffers contain the current and next block?
-			if (end > 0 && buf.offset == end)
-				allDone = true;
-		}
-	}
-	else
-	{
-		for (int i = 0; i < static_cast<int>(std::size(m_buffer) * 2); i++)
-		{
-			Buffer& buf = m_buffer[i % std::size(m_buffer)];
-			u32 bufsize = buf.size.load(std::memory_order_acquire);
-			if (!bufsize)
-				continue;
-			if (buf.offset <= offset && buf.offset + bufsize > offset)
+			else
 			{
-				size_t read;
-				u32 off      = offset - buf.offset;
-				u32 cpysize  = std::min(size, bufsize - off);
 				memcpy(buffer, static_cast<char*>(buf.ptr) + off, cpysize);
-				read         = cpysize;
-				m_amtRead   += read;
-				size        -= cpysize;
-				offset      += cpysize;
-				buffer       = static_cast<char*>(buffer) + read;
-				if (size == 0)
-					end  = buf.offset + bufsize;
+				read = cpysize;
 			}
-			// Do buffers contain the current and next block?
-			if (end > 0 && buf.offset == end)
-				allDone = true;
+			m_amtRead += read;
+			size      -= cpysize;
+			offset    += cpysize;
+			buffer     = static_cast<char*>(buffer) + read;
+			buf.lastUse.store(++m_useCounter, std::memory_order_relaxed);
+			progress   = true;
 		}
 	}
-	return allDone;
+
+	if (size > 0)
+		return false;
+
+	m_stats.hits.fetch_add(1, std::memory_order_relaxed);
+
+	// Only wake the read thread once the data ahead of us has been half used up,
+	// otherwise sequential reads would restart it for every request
+	const u32 wanted = WantedReadAhead() / 2;
+	return CachedBytesFrom(offset, wanted) >= wanted;
 }
 
 bool ThreadedFileReader::Open(std::string filename)
 {
 	CancelAndWaitUntilStopped();
+	ResizeCache();
 	return Open2(std::move(filename));
 }
 
@@ -311,11 +446,18 @@ int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
 	u32 blocksize = m_internalBlockSize ? m_internalBlockSize : m_blocksize;
 	u64 offset    = (u64)sector * (u64)blocksize + m_dataoffset;
 	u32 size      = count * blocksize;
+	u64 start = 0;
+	bool stalled;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		NoteRequest(offset, size);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return m_amtRead;
 
+		// A fully cached request can still get here to restart the read-ahead, that isn't a stall
+		stalled = size > 0;
+		if (stalled)
+			start = Common::Timer::GetCurrentValue();
 		if (size > 0 && !m_running)
 		{
 			// Don't wait for read thread to start back up
@@ -342,9 +484,11 @@ int ThreadedFileReader::ReadSync(void* pBuffer, u32 sector, u32 count)
 		m_requestCancelled.store(false, std::memory_order_relaxed);
 	}
 	m_condition.notify_one();
-	if (size == 0)
-		return m_amtRead;
-	return FinishRead();
+	if (size != 0)
+		WaitForRequest();
+	if (stalled)
+		NoteStall(start);
+	return m_amtRead;
 }
 
 void ThreadedFileReader::CancelAndWaitUntilStopped(void)
@@ -367,6 +511,7 @@ void ThreadedFileReader::BeginRead(void* pBuffer, u32 sector, u32 count)
 	u32 size      = count * blocksize;
 	{
 		std::lock_guard<std::mutex> l(m_mtx);
+		NoteRequest(offset, size);
 		if (TryCachedRead(pBuffer, offset, size, l))
 			return;
 		if (size == 0)
@@ -391,10 +536,23 @@ int ThreadedFileReader::FinishRead(void)
 {
 	if (m_requestPtr.load(std::memory_order_acquire) == nullptr)
 		return m_amtRead;
+	const u64 start = Common::Timer::GetCurrentValue();
+	WaitForRequest();
+	NoteStall(start);
+	return m_amtRead;
+}
+
+void ThreadedFileReader::WaitForRequest(void)
+{
 	std::unique_lock<std::mutex> lock(m_mtx);
 	while (m_requestPtr.load(std::memory_order_acquire))
 		m_condition.wait(lock);
-	return m_amtRead;
+}
+
+void ThreadedFileReader::NoteStall(u64 start)
+{
+	m_stats.stalls.fetch_add(1, std::memory_order_relaxed);
+	m_stats.stallTicks.fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
 }
 
 void ThreadedFileReader::CancelRead(void)
@@ -410,8 +568,9 @@ void ThreadedFileReader::CancelRead(void)
 void ThreadedFileReader::Close(void)
 {
 	CancelAndWaitUntilStopped();
-	for (auto& buf : m_buffer)
-		buf.size.store(0, std::memory_order_relaxed);
+	for (u32 i = 0; i < m_bufferCount; i++)
+		m_buffer[i].size.store(0, std::memory_order_relaxed);
+	LogStats();
 	Close2();
 }
 
@@ -21,6 +21,7 @@
 #include "../../common/Pcsx2Defs.h"
 
 #include <thread>
+#include <memory>
 #include <mutex>
 #include <atomic>
 #include <string>
@@ -28,6 +29,7 @@
 
 /// A file reader for use with compressed formats
 /// Calls decompression code on a separate thread to make a synchronous decompression API async
+/// Decompressed data is kept in an LRU cache of buffers, and sequential reads are decompressed ahead of time
 class ThreadedFileReader
 {
 	ThreadedFileReader(ThreadedFileReader&&) = delete;
@@ -80,10 +82,30 @@ private:
 		u64 offset = 0;
 		std::atomic<u32> size{0};
 		u32 cap = 0;
+		/// Value of m_useCounter when the buffer was last used, for LRU eviction
+		std::atomic<u64> lastUse{0};
 	};
-	/// 2 buffers for readahead (current block, next block)
-	Buffer m_buffer[2];
-	u32 m_nextBuffer = 0;
+	/// Cached data, at least 2 buffers (current block, next block)
+	std::unique_ptr<Buffer[]> m_buffer;
+	u32 m_bufferCount = 0;
+	std::atomic<u64> m_useCounter{0};
+
+	/// Bytes to decompress ahead of a sequential stream of reads
+	u32 m_readAhead = 0;
+	/// End of the last request, and how many requests in a row started there
+	u64 m_lastRequestEnd = 0;
+	u32 m_sequentialRun = 0;
+
+	struct StatCounters
+	{
+		std::atomic<u64> reads{0};
+		std::atomic<u64> hits{0};
+		std::atomic<u64> stalls{0};
+		std::atomic<u64> stallTicks{0};
+		std::atomic<u64> readAheadBytes{0};
+		std::atomic<u64> evictions{0};
+	};
+	StatCounters m_stats;
 
 	std::thread m_readThread;
 	std::mutex m_mtx;
@@ -98,7 +120,18 @@ private:
 	void Loop();
 
 	/// Load the given block into one of the `m_buffer` buffers if necessary and return a pointer to its contents if successful
-	Buffer* GetBlockPtr(const Chunk& block);
+	Buffer* GetBlockPtr(const Chunk& block, bool* loaded = nullptr);
+	/// Pick the buffer to load a new block into
+	Buffer& GetEvictionCandidate();
+	/// Number of contiguous bytes cached starting at offset, stops counting at limit
+	u64 CachedBytesFrom(u64 offset, u64 limit) const;
+	/// Sizes the cache from the current settings, must not race with the read thread
+	void ResizeCache();
+	/// Tracks whether requests are following each other, call with `m_mtx` held
+	void NoteRequest(u64 offset, u32 size);
+	/// Bytes that should be cached past the end of the current request
+	u32 WantedReadAhead() const;
+	void LogStats();
 	/// Decompress from offset to size into
 	bool Decompress(void* ptr, u64 offset, u32 size);
 	/// Cancel any inflight read and wait until the thread is no longer doing anything
@@ -107,10 +140,26 @@ private:
 	/// Adjusts pointer, offset, and size if successful
 	/// Returns true if no additional reads are necessary
 	bool TryCachedRead(void*& buffer, u64& offset, u32& size, const std::lock_guard<std::mutex>&);
+	/// Wait for the read thread to finish the current request
+	void WaitForRequest();
+	/// Record one request which missed the cache and waited since start
+	void NoteStall(u64 start);
 
 public:
+	struct Stats
+	{
+		u64 reads;          ///< read requests
+		u64 hits;           ///< requests served entirely from the cache
+		u64 stalls;         ///< requests which had to wait for decompression
+		u64 stallTicks;     ///< time spent waiting in those requests
+		u64 readAheadBytes; ///< bytes decompressed ahead of time
+		u64 evictions;      ///< buffers reused for other data
+	};
+
 	virtual ~ThreadedFileReader();
 
+	Stats GetStats() const;
+
 	virtual u32 GetBlockCount() const = 0;
 
 	bool Open(std::string filename);
@@ -204,6 +204,7 @@ enum class GSRendererType : s8
 {
 	Auto = -1,
 	DX11 = 3,
+	Null = 11,
 	OGL = 12,
 	SW = 13,
 	VK = 14,
@@ -379,6 +380,7 @@ struct Pcsx2Config
 
 				bool    EnableEECache    : 1;
 				bool    EnableFastmem    : 1;
+				bool    ProfileIOPBlocks : 1;
 			};
 		};
 
@@ -490,7 +492,9 @@ struct Pcsx2Config
 					UserHacks_EstimateTextureRegion : 1,
 					LoadTextureReplacements : 1,
 					LoadTextureReplacementsAsync : 1,
-					PrecacheTextureReplacements : 1;
+					PrecacheTextureReplacements : 1,
+					SWWorkStealing : 1,
+					LogMTGSStats : 1;
 			};
 		};
 
@@ -736,7 +740,8 @@ struct Pcsx2Config
 				     WaitLoop   : 1, // enables constant loop detection and fast-forwarding
 				     vuFlagHack : 1, // microVU specific flag hack
 				     vuThread   : 1, // Enable Threaded VU1
-				     vu1Instant : 1; // Enable Instant VU1 (Without MTVU only)
+				     vu1Instant : 1, // Enable Instant VU1 (Without MTVU only)
+				     ipuThread  : 1; // Finish IDEC macroblocks on a helper thread
 			};
 		};
 
@@ -875,6 +880,8 @@ struct Pcsx2Config
 	// slots (3 each)
 	McdOptions Mcd[8];
 	std::string GzipIsoIndexTemplate; // for quick-access index with gzipped ISO
+	uint CdvdCacheSize = 4;   // MB of decompressed data kept for compressed disc images
+	uint CdvdReadAhead = 512; // KB decompressed ahead of sequential reads from compressed disc images
 
 	// Set at runtime, not loaded from config.
 	std::string CurrentIRX;
@@ -26,6 +26,7 @@
 #include "GS/GS.h"
 #include "VUmicro.h"
 #include "Patch.h"
+#include "SPU2/spu2.h"
 
 #include "ps2/HwInternal.h"
 #include "VMManager.h"
@@ -559,6 +560,8 @@ static __fi void VSyncStart(u32 sCycle)
 	//These are done at VSync Start.  Drawing is done when VSync is off, then output the screen when Vsync is on
 	//The GS needs to be told at the start of a vsync else it loses half of its picture (could be responsible for some halfscreen issues)
 	//We got away with it before i think due to our awful GS timing, but now we have it right (ish)
+	// The frontend takes the frame's audio once it sees the vsync, so hand it over first.
+	SPU2::PushOutput();
 	MTGS::PostVsyncStart();
 	if (VMManager::Internal::IsExecutionInterrupted())
 		Cpu->ExitExecution();
@@ -634,6 +637,7 @@ static __fi void VSyncEnd(u32 sCycle)
 	psxVBlankEnd(); // psxCounters vBlank End
 	if (gates)
 		rcntEndGate(true, sCycle); // Counters End Gate Code
+	mVUdiskCacheWarmFrame();
 }
 
 static __fi void rcntUpdate_hScanline(void)
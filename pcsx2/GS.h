@@ -206,7 +206,33 @@ enum MTGS_RingCommand
 	GS_RINGTYPE_RESET, // issues a GSreset() command.
 	GS_RINGTYPE_GSPACKET,
 	GS_RINGTYPE_MTVU_GSPACKET,
-	GS_RINGTYPE_INIT_AND_READ_FIFO
+	GS_RINGTYPE_INIT_AND_READ_FIFO,
+	GS_RINGTYPE_COUNT
+};
+
+// Why the EE (or MTVU) thread waited for the GS thread to catch up.
+enum class MTGS_WaitReason : u8
+{
+	Sync,      // keeping the threads in step (resets, savestates, shutdown)
+	GifBuffer, // a GIF path buffer ran out of room
+	ReadFIFO,  // GS to EE transfers
+	Freeze,    // GS state save/load
+	Settings,  // renderer changes with unsynchronised downloads
+	Count
+};
+
+// Ring buffer occupancy and stall counters, since they were last reset.
+struct MTGS_RingStats
+{
+	u32 ring_size;                                           // ring entries
+	u32 high_water;                                          // most entries queued at once
+	u64 frames;                                              // vsyncs processed by the GS thread
+	u64 queue_stalls;                                        // times the EE waited for queued frames to drain (VsyncQueueSize)
+	u64 queue_stall_ticks;                                   // time spent in them
+	u64 wait_calls[static_cast<int>(MTGS_WaitReason::Count)]; // WaitGS() calls per reason
+	u64 wait_ticks[static_cast<int>(MTGS_WaitReason::Count)]; // time spent in them
+	u64 packets[GS_RINGTYPE_COUNT];                          // packets processed per type
+	u64 ticks;                                               // time the counts cover
 };
 
 
@@ -223,7 +249,7 @@ namespace MTGS
 	bool IsOpen();
 
 	// Waits for the GS to empty out the entire ring buffer contents.
-	void WaitGS(bool isMTVU);
+	void WaitGS(bool isMTVU, MTGS_WaitReason reason = MTGS_WaitReason::Sync);
 	void ResetGS(bool hardware_reset);
 
 	void WaitForClose();
@@ -240,6 +266,9 @@ namespace MTGS
 
 	void TryOpenGS(void);
 	void CloseGS(void);
+
+	MTGS_RingStats GetRingStats();
+	void ResetRingStats();
 };
 
 /////////////////////////////////////////////////////////////////////////////
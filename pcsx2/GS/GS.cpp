@@ -18,15 +18,18 @@
 #include "../../common/Path.h"
 
 #include "GS.h"
+#include "GSDump.h"
 #include "GSUtil.h"
 #include "GSExtra.h"
 #include "Renderers/HW/GSRendererHW.h"
 #include "Renderers/HW/GSTextureReplacements.h"
+#include "Renderers/Null/GSDeviceNull.h"
 #include "MultiISA.h"
 
 #include "../Config.h"
 #include "../Counters.h"
 #include "../GS.h"
+#include "../VMManager.h"
 
 #ifdef HAVE_PARALLEL_GS
 #include "Renderers/parallel-gs/GSRendererPGS.h"
@@ -49,12 +52,25 @@ std::unique_ptr<GSRendererPGS> g_pgs_renderer;
 
 #include <libretro.h>
 
+#include <atomic>
+#include <mutex>
+
 extern retro_hw_render_callback hw_render;
 
 int m_disp_fb_sprite_blits = 0;
 
 Pcsx2Config::GSOptions GSConfig;
 
+// GS dump recording. Requests come from the frontend thread, the dump itself is
+// only ever touched on the GS thread.
+static std::mutex s_gs_dump_request_mutex;
+static std::string s_gs_dump_request_filename;
+static std::string s_gs_dump_request_serial;
+static u32 s_gs_dump_request_crc = 0;
+static std::atomic<u32> s_gs_dump_request_frames{0};
+static std::unique_ptr<GSDump::Writer> s_gs_dump;
+static u32 s_gs_dump_frames_left = 0;
+
 void GSinit(void)
 {
 	GSVertexSW::InitStatic();
@@ -107,6 +123,19 @@ static GSRendererType GSsetRenderer(enum retro_hw_context_type api)
 
 static bool OpenGSDevice(GSRendererType renderer, bool clear_state_on_fail)
 {
+	// Hardware renderer without a GPU behind it, doesn't care what the frontend gave us.
+	if (renderer == GSRendererType::Null)
+	{
+		g_gs_device = std::make_unique<GSDeviceNull>();
+		if (!g_gs_device->Create())
+		{
+			g_gs_device->Destroy();
+			g_gs_device.reset();
+			return false;
+		}
+		return true;
+	}
+
 	switch (hw_render.context_type)
 	{
 		case RETRO_HW_CONTEXT_D3D11:
@@ -167,6 +196,9 @@ static bool OpenGSDevice(GSRendererType renderer, bool clear_state_on_fail)
 			return false;
 	}
 
+	if (g_gs_device)
+		g_gs_device->OpenPipelineUsageLog(VMManager::GetDiscSerial());
+
 	return true;
 }
 
@@ -361,6 +393,7 @@ void GSopen(const Pcsx2Config::GSOptions& config, GSRendererType renderer, enum
 
 void GSclose(void)
 {
+	s_gs_dump.reset();
 	CloseGSRenderer();
 	CloseGSDevice(true);
 }
@@ -377,6 +410,9 @@ void GSreset(bool hardware_reset)
 
 void GSgifSoftReset(u32 mask)
 {
+	if (s_gs_dump)
+		s_gs_dump->AddSoftReset(mask);
+
 	if (g_gs_renderer)
 		g_gs_renderer->SoftReset(mask);
 }
@@ -394,6 +430,9 @@ void GSInitAndReadFIFO(u8* mem, u32 size)
 		g_pgs_renderer->ReadFIFO(mem, size);
 #endif
 
+	if (s_gs_dump)
+		s_gs_dump->AddReadFIFO(size);
+
 	if (g_gs_renderer)
 	{
 		g_gs_renderer->InitReadFIFO(mem, size);
@@ -414,12 +453,68 @@ void GSgifTransfer(const u8* mem, u32 size)
 		g_pgs_renderer->Transfer(mem, size);
 #endif
 
+	if (s_gs_dump)
+		s_gs_dump->AddTransfer(mem, size);
+
 	if (g_gs_renderer)
 		g_gs_renderer->Transfer(mem, size);
 }
 
+static void GSBeginDump(void)
+{
+	std::string filename, serial;
+	u32 crc, frames;
+	{
+		std::unique_lock lock(s_gs_dump_request_mutex);
+		frames = s_gs_dump_request_frames.exchange(0, std::memory_order_relaxed);
+		filename = std::move(s_gs_dump_request_filename);
+		serial = std::move(s_gs_dump_request_serial);
+		crc = s_gs_dump_request_crc;
+	}
+
+	if (frames == 0 || !g_gs_renderer)
+		return;
+
+	freezeData fd = {};
+	if (g_gs_renderer->Freeze(&fd, true) != 0)
+		return;
+
+	std::vector<u8> state(fd.size);
+	fd.data = state.data();
+	if (g_gs_renderer->Freeze(&fd, false) != 0)
+	{
+		Console.Error("(GSDump) Failed to freeze GS");
+		return;
+	}
+
+	s_gs_dump = std::make_unique<GSDump::Writer>();
+	if (!s_gs_dump->Open(filename.c_str(), serial, crc, state, g_gs_renderer->GetRegsMem(), Ps2MemSize::GSregs))
+	{
+		s_gs_dump.reset();
+		return;
+	}
+
+	s_gs_dump_frames_left = frames;
+}
+
+void GSQueueDump(std::string filename, std::string serial, u32 crc, u32 frames)
+{
+	std::unique_lock lock(s_gs_dump_request_mutex);
+	s_gs_dump_request_filename = std::move(filename);
+	s_gs_dump_request_serial = std::move(serial);
+	s_gs_dump_request_crc = crc;
+	s_gs_dump_request_frames.store(frames, std::memory_order_release);
+}
+
 void GSvsync(u32 field, bool registers_written)
 {
+	if (s_gs_dump)
+	{
+		s_gs_dump->AddVSync(field, registers_written, g_gs_renderer->GetRegsMem(), Ps2MemSize::GSregs);
+		if (--s_gs_dump_frames_left == 0)
+			s_gs_dump.reset();
+	}
+
 #ifdef HAVE_PARALLEL_GS
 	if (g_pgs_renderer)
 		g_pgs_renderer->VSync(field, registers_written);
@@ -431,6 +526,10 @@ void GSvsync(u32 field, bool registers_written)
 		// get cleared in HW VSync, and may be needed for a buffered draw (FFX FMVs).
 		g_gs_renderer->Flush(GSState::VSYNC);
 		g_gs_renderer->VSync(field, registers_written, g_gs_renderer->IsIdleFrame());
+
+		// Dumps start on a frame boundary so the replay begins with a clean frame.
+		if (!s_gs_dump && s_gs_dump_request_frames.load(std::memory_order_acquire) != 0)
+			GSBeginDump();
 	}
 }
 
@@ -471,6 +570,9 @@ void GSGameChanged()
 {
 	if (GSConfig.UseHardwareRenderer())
 		GSTextureReplacements::GameChanged();
+
+	if (g_gs_device)
+		g_gs_device->OpenPipelineUsageLog(VMManager::GetDiscSerial());
 }
 
 void GSUpdateConfig(const Pcsx2Config::GSOptions& new_config, enum retro_hw_context_type api)
@@ -491,7 +593,8 @@ void GSUpdateConfig(const Pcsx2Config::GSOptions& new_config, enum retro_hw_cont
 	// Options which aren't using the global struct yet, so we need to recreate all GS objects.
 	if (
 		   GSConfig.SWExtraThreads       != old_config.SWExtraThreads
-		|| GSConfig.SWExtraThreadsHeight != old_config.SWExtraThreadsHeight)
+		|| GSConfig.SWExtraThreadsHeight != old_config.SWExtraThreadsHeight
+		|| GSConfig.SWWorkStealing       != old_config.SWWorkStealing)
 	{
 		if (!GSreopen(false, true, old_config))
 			Console.Error("Failed to do quick GS reopen");
@@ -75,6 +75,9 @@ void GSvsync(u32 field, bool registers_written);
 int GSfreeze(FreezeAction mode, freezeData* data);
 void GSGameChanged(void);
 
+/// Records the next frames of GS input to a dump file, starting at the next vsync. Callable from any thread.
+void GSQueueDump(std::string filename, std::string serial, u32 crc, u32 frames);
+
 void GSUpdateConfig(const Pcsx2Config::GSOptions& new_config, enum retro_hw_context_type api);
 void GSSwitchRenderer(GSRendererType new_renderer, enum retro_hw_context_type api, GSInterlaceMode new_interlace);
 
@@ -14,10 +14,12 @@
  */
 
 #include "../../common/AlignedMalloc.h"
+#include "../../common/Console.h"
 
 #include "GSClut.h"
 #include "GSExtra.h"
 #include "GSLocalMemory.h"
+#include "GSXXH.h"
 #include "Renderers/Common/GSDevice.h"
 #include "Renderers/Common/GSRenderer.h"
 
@@ -28,6 +30,8 @@ GSClut::GSClut(GSLocalMemory* mem)
 	m_clut   = static_cast<u16*>(_aligned_malloc(CLUT_ALLOC_SIZE, VECTOR_ALIGNMENT));
 	m_buff32 = reinterpret_cast<u32*>(reinterpret_cast<u8*>(m_clut) + 2048); // 1k
 	m_buff64 = reinterpret_cast<u64*>(reinterpret_cast<u8*>(m_clut) + 4096); // 2k
+	m_cache_data = static_cast<CacheData*>(_aligned_malloc(sizeof(CacheData) * CACHE_SIZE, VECTOR_ALIGNMENT));
+	memset(m_cache_data, 0, sizeof(CacheData) * CACHE_SIZE); // 4 bit palettes only fill the start
 	m_write.dirty = 1;
 	m_read.dirty = true;
 
@@ -100,9 +104,12 @@ GSClut::GSClut(GSLocalMemory* mem)
 
 GSClut::~GSClut()
 {
+	LogCacheStats();
+
 	delete m_gpu_clut4;
 	delete m_gpu_clut8;
 
+	_aligned_free(m_cache_data);
 	_aligned_free(m_clut);
 }
 
@@ -134,6 +141,13 @@ void GSClut::SetNextCLUTTEX0(u64 TEX0)
 
 void GSClut::Reset()
 {
+	LogCacheStats();
+
+	// The cache is keyed by content, so it stays valid, only stop reading from it.
+	m_buff32 = reinterpret_cast<u32*>(reinterpret_cast<u8*>(m_clut) + 2048);
+	m_buff64 = reinterpret_cast<u64*>(reinterpret_cast<u8*>(m_clut) + 4096);
+	m_cache_current = nullptr;
+
 	memset(m_CBP, 0, sizeof(m_CBP));
 	memset(m_clut, 0, CLUT_ALLOC_SIZE);
 	m_write = {};
@@ -321,22 +335,39 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 
 		u16* clut = m_clut;
 
+		// Only the alpha expansion of 16 bit palettes depends on TEXA.
+		const u64 texa16 = TEXA.U64 & 0x000000FF000080FFULL; // TA1, AEM, TA0
+
 		if (TEX0.CPSM == PSMCT32 || TEX0.CPSM == PSMCT24)
 		{
 			switch (TEX0.PSM)
 			{
 				case PSMT8:
 				case PSMT8H:
-					ReadCLUT_T32_I8(clut, m_buff32, (TEX0.CSA & 15) << 4);
+				{
+					const u32 offset = (TEX0.CSA & 15) << 4;
+					if (!LookupCache(clut, 1024, 0x10000 | offset, 0))
+						ReadCLUT_T32_I8(clut, m_buff32, offset);
 					break;
+				}
 				case PSMT4:
 				case PSMT4HL:
 				case PSMT4HH:
+				{
 					clut += (TEX0.CSA & 15) << 4;
-					// TODO: merge these functions
-					ReadCLUT_T32_I4(clut, m_buff32);
-					ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+
+					// The low and high halves are 512 bytes apart.
+					alignas(32) u16 raw[32];
+					memcpy(&raw[0], clut, 32);
+					memcpy(&raw[16], clut + 256, 32);
+					if (!LookupCache(raw, sizeof(raw), 0x20000, 0))
+					{
+						// TODO: merge these functions
+						ReadCLUT_T32_I4(clut, m_buff32);
+						ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+					}
 					break;
+				}
 			}
 		}
 		else if (TEX0.CPSM == PSMCT16 || TEX0.CPSM == PSMCT16S)
@@ -346,15 +377,19 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 				case PSMT8:
 				case PSMT8H:
 					clut += TEX0.CSA << 4;
-					Expand16(clut, m_buff32, 256, TEXA);
+					if (!LookupCache(clut, 512, 0x30000, texa16))
+						Expand16(clut, m_buff32, 256, TEXA);
 					break;
 				case PSMT4:
 				case PSMT4HL:
 				case PSMT4HH:
 					clut += TEX0.CSA << 4;
-					// TODO: merge these functions
-					Expand16(clut, m_buff32, 16, TEXA);
-					ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+					if (!LookupCache(clut, 32, 0x40000, texa16))
+					{
+						// TODO: merge these functions
+						Expand16(clut, m_buff32, 16, TEXA);
+						ExpandCLUT64_T32_I8(m_buff32, (u64*)m_buff64); // sw renderer does not need m_buff64 anymore
+					}
 					break;
 			}
 		}
@@ -408,6 +443,58 @@ void GSClut::Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA)
 	}
 }
 
+bool GSClut::LookupCache(const void* data, size_t size, u32 format, u64 texa)
+{
+	const u64 hash = GSXXH3_64bits(data, size);
+	const u32 tick = ++m_cache_tick;
+
+	CacheEntry* lru = &m_cache[0];
+	for (CacheEntry& entry : m_cache)
+	{
+		if (entry.valid && entry.hash == hash && entry.format == format && entry.texa == texa)
+		{
+			entry.last_use = tick;
+			m_cache_current = &entry;
+			m_buff32 = m_cache_data[&entry - m_cache].buff32;
+			m_buff64 = m_cache_data[&entry - m_cache].buff64;
+			m_cache_stats.hits++;
+			return true;
+		}
+
+		if (!entry.valid || (lru->valid && entry.last_use < lru->last_use))
+			lru = &entry;
+	}
+
+	if (lru->valid)
+		m_cache_stats.evictions++;
+	m_cache_stats.misses++;
+
+	lru->hash = hash;
+	lru->texa = texa;
+	lru->format = format;
+	lru->last_use = tick;
+	lru->valid = true;
+	lru->arange = false;
+	m_cache_current = lru;
+	m_buff32 = m_cache_data[lru - m_cache].buff32;
+	m_buff64 = m_cache_data[lru - m_cache].buff64;
+	return false;
+}
+
+void GSClut::LogCacheStats()
+{
+	const u64 lookups = m_cache_stats.hits + m_cache_stats.misses;
+	if (lookups > 0)
+	{
+		Console.WriteLn("GS: CLUT cache: %llu hits, %llu misses (%.1f%% hit rate), %llu evicted",
+			static_cast<unsigned long long>(m_cache_stats.hits), static_cast<unsigned long long>(m_cache_stats.misses),
+			100.0 * static_cast<double>(m_cache_stats.hits) / static_cast<double>(lookups),
+			static_cast<unsigned long long>(m_cache_stats.evictions));
+	}
+
+	m_cache_stats = {};
+}
+
 void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 {
 	// call only after Read32
@@ -421,6 +508,11 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 			m_read.amin = m_read.TEXA.TA0;
 			m_read.amax = m_read.TEXA.TA0;
 		}
+		else if (m_cache_current && m_cache_current->arange)
+		{
+			m_read.amin = m_cache_current->amin;
+			m_read.amax = m_cache_current->amax;
+		}
 		else
 		{
 			const GSVector4i* p = (const GSVector4i*)m_buff32;
@@ -464,6 +556,13 @@ void GSClut::GetAlphaMinMax32(int& amin_out, int& amax_out)
 
 			m_read.amin = v0.min_i16(v1).extract16<0>();
 			m_read.amax = v0.max_i16(v1).extract16<1>();
+
+			if (m_cache_current)
+			{
+				m_cache_current->amin = static_cast<s16>(m_read.amin);
+				m_cache_current->amax = static_cast<s16>(m_read.amax);
+				m_cache_current->arange = true;
+			}
 		}
 	}
 
@@ -62,6 +62,46 @@ class alignas(32) GSClut final : public GSAlignedClass<32>
 	GSTexture* m_gpu_clut8 = nullptr;
 	GSTexture* m_current_gpu_clut = nullptr;
 
+public:
+	struct CacheStats
+	{
+		u64 hits;
+		u64 misses;
+		u64 evictions;
+	};
+
+private:
+	// Expanded palettes, keyed by the raw entries they were expanded from, so switching back
+	// to a palette which was seen recently only has to hash it. m_buff32/m_buff64 point at
+	// the entry in use.
+	static constexpr u32 CACHE_SIZE = 64;
+
+	struct alignas(32) CacheData
+	{
+		u32 buff32[256];
+		u64 buff64[256];
+	};
+
+	struct CacheEntry
+	{
+		u64 hash;
+		u64 texa;
+		u32 format;
+		u32 last_use;
+		s16 amin, amax;
+		bool valid;
+		bool arange;
+	};
+
+	CacheData* m_cache_data = nullptr;
+	CacheEntry m_cache[CACHE_SIZE] = {};
+	CacheEntry* m_cache_current = nullptr;
+	u32 m_cache_tick = 0;
+	CacheStats m_cache_stats = {};
+
+	bool LookupCache(const void* data, size_t size, u32 format, u64 texa);
+	void LogCacheStats();
+
 	typedef void (GSClut::*writeCLUT)(const GIFRegTEX0& TEX0, const GIFRegTEXCLUT& TEXCLUT);
 
 	writeCLUT m_wc[2][16][64];
@@ -124,6 +164,8 @@ public:
 	void Read32(const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 	void GetAlphaMinMax32(int& amin, int& amax);
 
+	__fi const CacheStats& GetCacheStats() const { return m_cache_stats; }
+
 	u32 operator[](size_t i) const { return m_buff32[i]; }
 
 	operator const u32*() const { return m_buff32; }
@@ -0,0 +1,196 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include "../../common/Console.h"
+#include "../../common/FileSystem.h"
+#include "../../common/StringUtil.h"
+#include "../../common/Timer.h"
+
+#include "GSDump.h"
+#include "GSState.h"
+
+GSDump::Writer::Writer() = default;
+
+GSDump::Writer::~Writer()
+{
+	Close();
+}
+
+bool GSDump::Writer::Open(const char* filename, const std::string& serial, u32 crc,
+	const std::vector<u8>& state, const u8* regs, u32 regs_size)
+{
+	Close();
+
+	m_fp = FileSystem::OpenFile(filename, "wb");
+	if (!m_fp)
+	{
+		Console.Error("(GSDump) Failed to open '%s' for writing", filename);
+		return false;
+	}
+
+	Header header = {};
+	header.magic = MAGIC;
+	header.version = VERSION;
+	header.state_version = GSState::STATE_VERSION;
+	header.crc = crc;
+	header.serial_size = static_cast<u32>(serial.size());
+	header.state_size = static_cast<u32>(state.size());
+	header.regs_size = regs_size;
+
+	rfwrite(&header, sizeof(header), 1, m_fp);
+	rfwrite(serial.data(), serial.size(), 1, m_fp);
+	rfwrite(state.data(), state.size(), 1, m_fp);
+	rfwrite(regs, regs_size, 1, m_fp);
+
+	m_start_time = Common::Timer::GetCurrentValue();
+	m_frames = 0;
+
+	Console.WriteLn("(GSDump) Recording to '%s'", filename);
+	return true;
+}
+
+void GSDump::Writer::Close()
+{
+	if (!m_fp)
+		return;
+
+	rfclose(m_fp);
+	m_fp = nullptr;
+
+	Console.WriteLn("(GSDump) Recorded %u frames", m_frames);
+}
+
+void GSDump::Writer::WritePacket(PacketType type, const void* data, u32 size)
+{
+	PacketHeader packet;
+	packet.type = type;
+	std::memset(packet.pad, 0, sizeof(packet.pad));
+	packet.size = size;
+	packet.timestamp = static_cast<u64>(
+		Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - m_start_time) * 1000000000.0);
+
+	rfwrite(&packet, sizeof(packet), 1, m_fp);
+	if (size > 0)
+		rfwrite(data, size, 1, m_fp);
+}
+
+void GSDump::Writer::AddTransfer(const u8* mem, u32 size)
+{
+	WritePacket(PacketType::Transfer, mem, size * 16);
+}
+
+void GSDump::Writer::AddVSync(u32 field, bool registers_written, const u8* regs, u32 regs_size)
+{
+	// Privileged registers are written directly into GS memory by the EE, so they never pass
+	// through the transfer path. Snapshot them whenever the EE touched them this frame.
+	if (registers_written)
+		WritePacket(PacketType::Registers, regs, regs_size);
+
+	const u8 data[2] = {static_cast<u8>(field), static_cast<u8>(registers_written)};
+	WritePacket(PacketType::VSync, data, sizeof(data));
+	m_frames++;
+}
+
+void GSDump::Writer::AddReadFIFO(u32 qwc)
+{
+	WritePacket(PacketType::ReadFIFO, &qwc, sizeof(qwc));
+}
+
+void GSDump::Writer::AddSoftReset(u32 mask)
+{
+	WritePacket(PacketType::SoftReset, &mask, sizeof(mask));
+}
+
+bool GSDump::File::Load(const char* filename, std::string* error)
+{
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(filename);
+	if (!data.has_value())
+	{
+		*error = StringUtil::StdStringFromFormat("Failed to read '%s'", filename);
+		return false;
+	}
+
+	const u8* ptr = data->data();
+	const u8* end = ptr + data->size();
+
+	Header header;
+	if (data->size() < sizeof(header))
+	{
+		*error = "File is too small to be a GS dump";
+		return false;
+	}
+	std::memcpy(&header, ptr, sizeof(header));
+	ptr += sizeof(header);
+
+	if (header.magic != MAGIC)
+	{
+		*error = "File is not a GS dump";
+		return false;
+	}
+	if (header.version != VERSION)
+	{
+		*error = StringUtil::StdStringFromFormat("Unsupported dump version %u (expected %u)", header.version, VERSION);
+		return false;
+	}
+
+	const size_t blob_size = static_cast<size_t>(header.serial_size) + header.state_size + header.regs_size;
+	if (static_cast<size_t>(end - ptr) < blob_size)
+	{
+		*error = "GS dump header is truncated";
+		return false;
+	}
+
+	crc = header.crc;
+	state_version = header.state_version;
+	serial.assign(reinterpret_cast<const char*>(ptr), header.serial_size);
+	ptr += header.serial_size;
+	state.assign(ptr, ptr + header.state_size);
+	ptr += header.state_size;
+	regs.assign(ptr, ptr + header.regs_size);
+	ptr += header.regs_size;
+
+	packets.clear();
+	packet_data.clear();
+	packet_data.reserve(end - ptr);
+	frame_count = 0;
+
+	while (static_cast<size_t>(end - ptr) >= sizeof(PacketHeader))
+	{
+		PacketHeader ph;
+		std::memcpy(&ph, ptr, sizeof(ph));
+		ptr += sizeof(ph);
+
+		// A dump cut short by a crash is still usable up to the last complete packet.
+		if (static_cast<size_t>(end - ptr) < ph.size)
+			break;
+
+		Packet packet;
+		packet.type = ph.type;
+		packet.timestamp = ph.timestamp;
+		packet.offset = packet_data.size();
+		packet.size = ph.size;
+		packets.push_back(packet);
+
+		packet_data.insert(packet_data.end(), ptr, ptr + ph.size);
+		ptr += ph.size;
+
+		if (ph.type == PacketType::VSync)
+			frame_count++;
+	}
+
+	return true;
+}
@@ -0,0 +1,123 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../common/Pcsx2Defs.h"
+
+#include <string>
+#include <vector>
+
+#include <streams/file_stream.h>
+
+// GS dumps capture everything the MTGS feeds into the GS front end, so a sequence of
+// frames can be replayed without the EE/IOP/VU running.
+//
+// Layout (little endian):
+//   Header
+//   serial        (header.serial_size bytes)
+//   GS freeze     (header.state_size bytes, GSState::Freeze() output)
+//   GS registers  (header.regs_size bytes, the privileged register block)
+//   packets       (PacketHeader followed by packet.size bytes of payload) until EOF
+
+namespace GSDump
+{
+	static constexpr u32 MAGIC = 0x50445347; // 'GSDP'
+	static constexpr u32 VERSION = 1;
+
+	enum class PacketType : u8
+	{
+		Transfer = 0,  // payload: GIF data sent through GSgifTransfer()
+		VSync = 1,     // payload: u8 field, u8 registers_written
+		ReadFIFO = 2,  // payload: u32 qwc requested by GSInitAndReadFIFO()
+		Registers = 3, // payload: full privileged register block
+		SoftReset = 4, // payload: u32 mask passed to GSgifSoftReset()
+	};
+
+#pragma pack(push, 1)
+	struct Header
+	{
+		u32 magic;
+		u32 version;
+		u32 state_version;
+		u32 crc;
+		u32 serial_size;
+		u32 state_size;
+		u32 regs_size;
+	};
+
+	struct PacketHeader
+	{
+		PacketType type;
+		u8 pad[3];
+		u32 size;
+		u64 timestamp; // nanoseconds since the dump was started
+	};
+#pragma pack(pop)
+
+	static_assert(sizeof(Header) == 28);
+	static_assert(sizeof(PacketHeader) == 16);
+
+	class Writer
+	{
+	public:
+		Writer();
+		~Writer();
+
+		bool Open(const char* filename, const std::string& serial, u32 crc,
+			const std::vector<u8>& state, const u8* regs, u32 regs_size);
+		void Close();
+
+		bool IsOpen() const { return m_fp != nullptr; }
+		u32 GetFrameCount() const { return m_frames; }
+
+		void AddTransfer(const u8* mem, u32 size); // size in quadwords
+		void AddVSync(u32 field, bool registers_written, const u8* regs, u32 regs_size);
+		void AddReadFIFO(u32 qwc);
+		void AddSoftReset(u32 mask);
+
+	private:
+		void WritePacket(PacketType type, const void* data, u32 size);
+
+		RFILE* m_fp = nullptr;
+		u64 m_start_time = 0;
+		u32 m_frames = 0;
+	};
+
+	struct Packet
+	{
+		PacketType type;
+		u64 timestamp;
+		size_t offset; // into File::packet_data
+		u32 size;
+	};
+
+	// Whole dump loaded into memory, so replay isn't bound by file I/O.
+	struct File
+	{
+		std::string serial;
+		u32 crc = 0;
+		u32 state_version = 0;
+		std::vector<u8> state;
+		std::vector<u8> regs;
+		std::vector<Packet> packets;
+		std::vector<u8> packet_data;
+		u32 frame_count = 0;
+
+		bool Load(const char* filename, std::string* error);
+
+		const u8* GetPacketData(const Packet& packet) const { return packet_data.data() + packet.offset; }
+	};
+} // namespace GSDump
@@ -18,6 +18,7 @@
 #include "GS.h"
 #include "GSLocalMemory.h"
 #include "GSExtra.h"
+#include "../SaveStateDelta.h"
 
 template <typename Fn>
 static void foreachBlock(const GSOffset& off, GSLocalMemory* mem, const GSVector4i& r, u8* dst, int dstpitch, int bpp, Fn&& fn)
@@ -63,6 +64,7 @@ GSLocalMemory::GSLocalMemory()
 {
 	m_vm8 = (u8*)GSAllocateWrappedMemory(m_vmsize, 4);
 	memset(m_vm8, 0, m_vmsize);
+	SaveStateDelta::RegisterTracked(SaveStateDelta::TRACK_GS_MEM, m_vm8, 4, m_vmsize, nullptr);
 
 	MULTI_ISA_SELECT(GSLocalMemoryPopulateFunctions)(*this);
 
@@ -244,7 +246,10 @@ GSLocalMemory::GSLocalMemory()
 GSLocalMemory::~GSLocalMemory()
 {
 	if (m_vm8)
+	{
+		SaveStateDelta::UnregisterTracked(SaveStateDelta::TRACK_GS_MEM);
 		GSFreeWrappedMemory(m_vm8, m_vmsize, 4);
+	}
 
 	for (auto& i : m_pomap)
 		_aligned_free(i.second);
@@ -20,6 +20,7 @@
 
 #include "../../common/Console.h"
 #include "../../common/Path.h"
+#include "../SaveStateDelta.h"
 
 #include "GSState.h"
 #include "GSUtil.h"
@@ -2349,7 +2350,8 @@ int GSState::Freeze(freezeData* fd, bool sizeonly)
 	data += sizeof(GIFReg); // obsolite
 	WriteState(data, &m_tr.x);
 	WriteState(data, &m_tr.y);
-	WriteState(data, m_mem.m_vm8, m_mem.m_vmsize);
+	SaveStateDelta::CopyTracked(SaveStateDelta::TRACK_GS_MEM, m_mem.m_vm8, data, m_mem.m_vmsize, false);
+	data += m_mem.m_vmsize;
 
 	for (GIFPath& path : m_path)
 	{
@@ -2455,7 +2457,8 @@ int GSState::Defrost(const freezeData* fd)
 	data += sizeof(GIFReg); // obsolite
 	ReadState(&m_tr.x, data);
 	ReadState(&m_tr.y, data);
-	ReadState(m_mem.m_vm8, data, m_mem.m_vmsize);
+	SaveStateDelta::CopyTracked(SaveStateDelta::TRACK_GS_MEM, m_mem.m_vm8, data, m_mem.m_vmsize, true);
+	data += m_mem.m_vmsize;
 
 	m_tr.total = 0; // TODO: restore transfer state
 
@@ -120,10 +120,63 @@ bool GSDevice::Create()
 
 void GSDevice::Destroy()
 {
+	m_pipeline_usage_log.Close();
 	ClearCurrent();
 	PurgePool();
 }
 
+u32 GSDevice::GetPipelineUsageKeySize() const
+{
+	return 0;
+}
+
+bool GSDevice::PrewarmPipeline(const void*)
+{
+	return false;
+}
+
+void GSDevice::OpenPipelineUsageLog(const std::string_view& serial)
+{
+	const u32 key_size = GetPipelineUsageKeySize();
+	if (serial.empty() || key_size == 0 || GSConfig.DisableShaderCache)
+	{
+		m_pipeline_usage_log.Close();
+		return;
+	}
+
+	const char* backend;
+	switch (GetRenderAPI())
+	{
+		case RenderAPI::D3D11:
+			backend = "d3d11";
+			break;
+		case RenderAPI::D3D12:
+			backend = "d3d12";
+			break;
+		case RenderAPI::Vulkan:
+			backend = "vulkan";
+			break;
+		case RenderAPI::OpenGL:
+			backend = "opengl";
+			break;
+		default:
+			return;
+	}
+
+	std::string path(GSPipelineUsageLog::GetPath(serial, backend));
+	if (path != m_pipeline_usage_log.GetPath())
+		m_pipeline_usage_log.Open(std::move(path), key_size);
+}
+
+void GSDevice::PrewarmPipelines()
+{
+	if (!m_pipeline_usage_log.IsReplaying())
+		return;
+
+	// Spread over the first frames, which are usually the BIOS or an intro that barely draws anything.
+	m_pipeline_usage_log.Replay(PIPELINE_PREWARM_BUDGET_MS / 1000.0, [this](const void* key) { return PrewarmPipeline(key); });
+}
+
 void GSDevice::AcquireWindow(void)
 {
 	std::optional<WindowInfo> wi = Host::AcquireRenderWindow();
@@ -25,6 +25,7 @@
 #include "../../GSExtra.h"
 
 #include "GSFastList.h"
+#include "GSPipelineUsageLog.h"
 #include "GSTexture.h"
 #include "GSVertex.h"
 
@@ -751,6 +752,7 @@ protected:
 	static constexpr u32 MAX_POOLED_TEXTURES = 300;
 	static constexpr u32 MAX_TEXTURE_AGE = 10;
 	static constexpr u32 EXPAND_BUFFER_SIZE = sizeof(u16) * 16383 * 6;
+	static constexpr u32 PIPELINE_PREWARM_BUDGET_MS = 4;
 
 	WindowInfo m_window_info;
 
@@ -773,6 +775,9 @@ protected:
 	bool m_rbswapped = false;
 	FeatureSupport m_features;
 
+	/// Pipelines this game created, backends record their selectors when they create a pipeline.
+	GSPipelineUsageLog m_pipeline_usage_log;
+
 	void AcquireWindow();
 
 	virtual GSTexture* CreateSurface(GSTexture::Type type, int width, int height, int levels, GSTexture::Format format) = 0;
@@ -781,6 +786,12 @@ protected:
 	virtual void DoMerge(GSTexture* sTex[3], GSVector4* sRect, GSTexture* dTex, GSVector4* dRect, const GSRegPMODE& PMODE, const GSRegEXTBUF& EXTBUF, u32 c, const bool linear) = 0;
 	virtual void DoInterlace(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, ShaderInterlace shader, bool linear, const InterlaceConstantBuffer& cb) = 0;
 
+	/// Size of the selector the backend records in the usage log, zero if it doesn't support prewarming.
+	virtual u32 GetPipelineUsageKeySize() const;
+
+	/// Creates the pipeline for a recorded selector without binding it.
+	virtual bool PrewarmPipeline(const void* key);
+
 public:
 	GSDevice();
 	virtual ~GSDevice();
@@ -855,6 +866,12 @@ public:
 
 	virtual void ClearSamplerCache() = 0;
 
+	/// Switches the pipeline usage log over to the given game. An empty serial closes it.
+	void OpenPipelineUsageLog(const std::string_view& serial);
+
+	/// Builds some of the pipelines the game used last time, called once per frame.
+	void PrewarmPipelines();
+
 	void ClearCurrent();
 	void Merge(GSTexture* sTex[3], GSVector4* sRect, GSVector4* dRect, const GSVector2i& fs, const GSRegPMODE& PMODE, const GSRegEXTBUF& EXTBUF, u32 c);
 	void Interlace(const GSVector2i& ds, int field, int mode, float yoffset);
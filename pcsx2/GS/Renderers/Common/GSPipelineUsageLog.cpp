@@ -0,0 +1,249 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
+#include "common/Timer.h"
+
+#include "GSPipelineUsageLog.h"
+#include "../../GSXXH.h"
+#include "../../../Config.h"
+#include "ShaderCacheVersion.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Layout: header, then count records of {u64 first use in ms, key bytes}. The checksum covers
+// the records, and the shader cache version retires logs when the selectors change meaning.
+static constexpr u32 USAGE_LOG_MAGIC = 0x4C505347; // 'GSPL'
+
+struct UsageLogHeader
+{
+	u32 magic;
+	u32 shader_cache_version;
+	u32 key_size;
+	u32 count;
+	u64 checksum;
+};
+
+GSPipelineUsageLog::GSPipelineUsageLog() = default;
+
+GSPipelineUsageLog::~GSPipelineUsageLog()
+{
+	Close();
+}
+
+std::string GSPipelineUsageLog::GetPath(const std::string_view& serial, const std::string_view& backend)
+{
+	return Path::Combine(EmuFolders::Cache, StringUtil::StdStringFromFormat("pipelines_%.*s_%.*s.bin",
+		static_cast<int>(serial.size()), serial.data(), static_cast<int>(backend.size()), backend.data()));
+}
+
+void GSPipelineUsageLog::Open(std::string path, u32 key_size)
+{
+	Close();
+
+	m_path = std::move(path);
+	m_key_size = key_size;
+	m_open_time = Common::Timer::GetCurrentValue();
+
+	std::optional<std::vector<u8>> data(FileSystem::ReadBinaryFile(m_path.c_str()));
+	if (data.has_value() && !Deserialize(data->data(), data->size(), key_size))
+	{
+		Console.Warning("Discarding stale pipeline usage log '%s'", m_path.c_str());
+		Clear();
+		m_key_size = key_size;
+	}
+
+	if (m_stats.loaded > 0)
+		Console.WriteLn("Loaded %u pipelines to prepare from '%s'", m_stats.loaded, m_path.c_str());
+}
+
+void GSPipelineUsageLog::Close()
+{
+	if (!IsOpen())
+		return;
+
+	const Stats stats = GetStats();
+	if (stats.loaded > 0 || stats.recorded > 0)
+	{
+		Console.WriteLn("Pipeline usage: %u loaded, %u new, %u prepared ahead (%u failed, %u left) in %.2f ms",
+			stats.loaded, stats.recorded, stats.replayed, stats.failed, stats.remaining,
+			Common::Timer::ConvertValueToSeconds(stats.replay_ticks) * 1e3);
+	}
+
+	if (m_dirty)
+	{
+		const std::vector<u8> data(Serialize());
+		if (!FileSystem::WriteBinaryFile(m_path.c_str(), data.data(), data.size()))
+			Console.Error("Failed to write pipeline usage log '%s'", m_path.c_str());
+	}
+
+	Clear();
+	m_path.clear();
+}
+
+void GSPipelineUsageLog::Clear()
+{
+	m_key_size = 0;
+	m_keys.clear();
+	m_first_use.clear();
+	m_key_index.clear();
+	m_replay_order.clear();
+	m_replay_pos = 0;
+	m_dirty = false;
+	m_stats = {};
+}
+
+u32 GSPipelineUsageLog::AddKey(const void* key, u64 first_use)
+{
+	const u32 index = static_cast<u32>(m_first_use.size());
+	const auto [it, inserted] = m_key_index.emplace(std::string(static_cast<const char*>(key), m_key_size), index);
+	if (!inserted)
+		return it->second;
+
+	m_keys.insert(m_keys.end(), static_cast<const u8*>(key), static_cast<const u8*>(key) + m_key_size);
+	m_first_use.push_back(first_use);
+	return index;
+}
+
+void GSPipelineUsageLog::Record(const void* key)
+{
+	if (!IsOpen())
+		return;
+
+	// Pipelines are only created once per session, so this is well off the hot path.
+	const u32 count = static_cast<u32>(m_first_use.size());
+	const u64 now_ms = static_cast<u64>(Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - m_open_time) * 1e3);
+	const u32 index = AddKey(key, now_ms);
+	if (index == count)
+	{
+		m_stats.recorded++;
+		m_dirty = true;
+	}
+	else if (m_first_use[index] == UINT64_MAX)
+	{
+		// Failed to replay, but the game got it to work, so keep it after all.
+		m_first_use[index] = now_ms;
+	}
+}
+
+u32 GSPipelineUsageLog::Replay(double budget_seconds, const CreateCallback& create)
+{
+	const u64 start = Common::Timer::GetCurrentValue();
+	u32 count = 0;
+	while (IsReplaying())
+	{
+		const u32 index = m_replay_order[m_replay_pos++];
+		count++;
+
+		if (create(&m_keys[static_cast<size_t>(index) * m_key_size]))
+		{
+			m_stats.replayed++;
+		}
+		else
+		{
+			// Leave it in the log if the game asks for it again, but don't try it next time around.
+			m_stats.failed++;
+			m_first_use[index] = UINT64_MAX;
+			m_dirty = true;
+		}
+
+		if (Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start) >= budget_seconds)
+			break;
+	}
+
+	m_stats.replay_ticks += Common::Timer::GetCurrentValue() - start;
+	return count;
+}
+
+GSPipelineUsageLog::Stats GSPipelineUsageLog::GetStats() const
+{
+	Stats stats = m_stats;
+	stats.remaining = static_cast<u32>(m_replay_order.size() - m_replay_pos);
+	return stats;
+}
+
+std::vector<u8> GSPipelineUsageLog::Serialize() const
+{
+	const size_t record_size = sizeof(u64) + m_key_size;
+
+	// Rejected keys are dropped, unless the game went on to use them anyway.
+	std::vector<u8> records;
+	records.reserve(m_first_use.size() * record_size);
+	u32 count = 0;
+	for (size_t i = 0; i < m_first_use.size(); i++)
+	{
+		if (m_first_use[i] == UINT64_MAX)
+			continue;
+
+		const u8* first_use = reinterpret_cast<const u8*>(&m_first_use[i]);
+		records.insert(records.end(), first_use, first_use + sizeof(u64));
+		records.insert(records.end(), &m_keys[i * m_key_size], &m_keys[i * m_key_size] + m_key_size);
+		count++;
+	}
+
+	UsageLogHeader header;
+	header.magic = USAGE_LOG_MAGIC;
+	header.shader_cache_version = SHADER_CACHE_VERSION;
+	header.key_size = m_key_size;
+	header.count = count;
+	header.checksum = XXH3_64bits(records.data(), records.size());
+
+	std::vector<u8> data(sizeof(header) + records.size());
+	std::memcpy(data.data(), &header, sizeof(header));
+	if (!records.empty())
+		std::memcpy(data.data() + sizeof(header), records.data(), records.size());
+	return data;
+}
+
+bool GSPipelineUsageLog::Deserialize(const u8* data, size_t size, u32 key_size)
+{
+	Clear();
+	m_key_size = key_size;
+
+	UsageLogHeader header;
+	if (size < sizeof(header))
+		return false;
+
+	std::memcpy(&header, data, sizeof(header));
+	const size_t record_size = sizeof(u64) + key_size;
+	if (header.magic != USAGE_LOG_MAGIC || header.shader_cache_version != SHADER_CACHE_VERSION || header.key_size != key_size ||
+		(size - sizeof(header)) != static_cast<size_t>(header.count) * record_size ||
+		header.checksum != XXH3_64bits(data + sizeof(header), size - sizeof(header)))
+	{
+		return false;
+	}
+
+	const u8* record = data + sizeof(header);
+	for (u32 i = 0; i < header.count; i++, record += record_size)
+	{
+		u64 first_use;
+		std::memcpy(&first_use, record, sizeof(first_use));
+		AddKey(record + sizeof(u64), first_use);
+	}
+
+	// Build them in the order the game got to them last time.
+	m_replay_order.resize(m_first_use.size());
+	for (u32 i = 0; i < static_cast<u32>(m_replay_order.size()); i++)
+		m_replay_order[i] = i;
+	std::stable_sort(m_replay_order.begin(), m_replay_order.end(),
+		[this](u32 lhs, u32 rhs) { return m_first_use[lhs] < m_first_use[rhs]; });
+
+	m_stats.loaded = static_cast<u32>(m_first_use.size());
+	return true;
+}
@@ -0,0 +1,92 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Pcsx2Defs.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/// Remembers which pipelines a game needed and when it first needed them, so the next boot can
+/// build them ahead of the draws that use them. Keys are opaque fixed-size blobs (a backend's
+/// pipeline selector), nothing in here touches a graphics API.
+class GSPipelineUsageLog
+{
+public:
+	/// Returns false if the key couldn't be used, it's dropped from the log.
+	using CreateCallback = std::function<bool(const void* key)>;
+
+	struct Stats
+	{
+		u32 loaded;       ///< keys read from the previous log
+		u32 recorded;     ///< keys first seen this session
+		u32 replayed;     ///< keys built ahead of time
+		u32 failed;       ///< keys the backend rejected
+		u32 remaining;    ///< keys still waiting to be replayed
+		u64 replay_ticks; ///< time spent replaying
+	};
+
+	GSPipelineUsageLog();
+	~GSPipelineUsageLog();
+
+	__fi bool IsOpen() const { return !m_path.empty(); }
+	__fi bool IsReplaying() const { return m_replay_pos < m_replay_order.size(); }
+	__fi const std::string& GetPath() const { return m_path; }
+
+	/// Usage log filename for a game on a given backend.
+	static std::string GetPath(const std::string_view& serial, const std::string_view& backend);
+
+	/// Loads the log at path and queues its keys for replay. A missing or stale log starts empty.
+	void Open(std::string path, u32 key_size);
+
+	/// Writes the log out if anything was added, and forgets it.
+	void Close();
+
+	/// Notes that a pipeline was created for a draw. Only the first use of each key is kept.
+	void Record(const void* key);
+
+	/// Hands queued keys to create in first-use order until budget_seconds have passed.
+	/// Returns the number of keys handed out.
+	u32 Replay(double budget_seconds, const CreateCallback& create);
+
+	Stats GetStats() const;
+
+	/// Serialised form of the log, separate from the file handling so it can be checked on its own.
+	std::vector<u8> Serialize() const;
+	bool Deserialize(const u8* data, size_t size, u32 key_size);
+
+private:
+	u32 AddKey(const void* key, u64 first_use);
+	void Clear();
+
+	std::string m_path;
+	u32 m_key_size = 0;
+
+	/// Keys back to back, with the first use of each in milliseconds since the log was opened.
+	std::vector<u8> m_keys;
+	std::vector<u64> m_first_use;
+	std::unordered_map<std::string, u32> m_key_index;
+
+	std::vector<u32> m_replay_order;
+	size_t m_replay_pos = 0;
+
+	u64 m_open_time = 0;
+	bool m_dirty = false;
+	Stats m_stats = {};
+};
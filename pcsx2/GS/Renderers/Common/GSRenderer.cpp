@@ -35,7 +35,7 @@ GSRenderer::~GSRenderer() = default;
 void GSRenderer::Reset(bool hardware_reset)
 {
 	// clear the current display texture
-	if (hardware_reset)
+	if (hardware_reset && g_gs_device)
 		g_gs_device->ClearCurrent();
 
 	GSState::Reset(hardware_reset);
@@ -264,6 +264,14 @@ void GSRenderer::VSync(u32 field, bool registers_written, bool idle_frame)
 
 	m_disp_fb_sprite_blits     = 0;
 
+	// Headless (GS dump replay), there is nothing to merge or present to.
+	if (!g_gs_device)
+	{
+		m_last_draw_n = s_n;
+		m_last_transfer_n = s_transfer_n;
+		return;
+	}
+
 	if (GSConfig.SkipDuplicateFrames)
 	{
 		switch (PerformanceMetrics::GetInternalFPSMethod())
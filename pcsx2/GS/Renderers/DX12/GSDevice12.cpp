@@ -2084,9 +2084,25 @@ const ID3D12PipelineState* GSDevice12::GetTFXPipeline(const PipelineSelector& p)
 
 	ComPtr<ID3D12PipelineState> pipeline(CreateTFXPipeline(p));
 	it = m_tfx_pipelines.emplace(p, std::move(pipeline)).first;
+	m_pipeline_usage_log.Record(&p);
 	return it->second.get();
 }
 
+u32 GSDevice12::GetPipelineUsageKeySize() const
+{
+	return sizeof(PipelineSelector);
+}
+
+bool GSDevice12::PrewarmPipeline(const void* key)
+{
+	PipelineSelector p;
+	std::memcpy(&p, key, sizeof(p));
+	if (p.topology > static_cast<u8>(GSHWDrawConfig::Topology::Triangle))
+		return false;
+
+	return (GetTFXPipeline(p) != nullptr);
+}
+
 bool GSDevice12::BindDrawPipeline(const PipelineSelector& p)
 {
 	const ID3D12PipelineState* pipeline = GetTFXPipeline(p);
@@ -221,6 +221,9 @@ private:
 	ComPtr<ID3D12PipelineState> CreateTFXPipeline(const PipelineSelector& p);
 	const ID3D12PipelineState* GetTFXPipeline(const PipelineSelector& p);
 
+	u32 GetPipelineUsageKeySize() const override;
+	bool PrewarmPipeline(const void* key) override;
+
 	ComPtr<ID3DBlob> GetUtilityVertexShader(const std::string& source, const char* entry_point);
 	ComPtr<ID3DBlob> GetUtilityPixelShader(const std::string& source, const char* entry_point);
 	ComPtr<ID3DBlob> GetUtilityVertexShader(const char *source, size_t len, const char* entry_point);
@@ -107,6 +107,8 @@ void GSRendererHW::VSync(u32 field, bool registers_written, bool idle_frame)
 	if (GSConfig.LoadTextureReplacements)
 		GSTextureReplacements::ProcessAsyncLoadedTextures();
 
+	g_gs_device->PrewarmPipelines();
+
 	if (!idle_frame)
 	{
 		// If it did draws very recently, we should keep the recent stuff in case it hasn't been preloaded/used yet.
@@ -13,6 +13,7 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <deque>
@@ -23,11 +24,23 @@
 #include <tuple>
 #include <thread>
 
+#include "common/Align.h"
 #include "common/Console.h"
 #include "common/HashCombine.h"
 #include "common/FileSystem.h"
 #include "common/Path.h"
 #include "common/TextureDecompress.h"
+#include "common/Timer.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include "common/RedtapeWindows.h"
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #include "../../../Config.h"
 
@@ -45,6 +58,7 @@
 #define TEXTURE_FILENAME_OLD_REGION_FORMAT_STRING "%" PRIx64 "-r%" PRIx64 "-%08x"
 #define TEXTURE_FILENAME_OLD_REGION_CLUT_FORMAT_STRING "%" PRIx64 "-%" PRIx64 "-r%" PRIx64 "-%08x"
 #define TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME "replacements"
+#define TEXTURE_REPLACEMENT_PACK_NAME "replacements.pack"
 
 namespace
 {
@@ -86,6 +100,47 @@ namespace
 			unused0 = 0;
 		}
 	};
+
+	// Replacement packs hold every replacement for a game with its mip chain already decoded (or still
+	// BC compressed), so it can be mapped and uploaded without going through a loader. Entries are
+	// sorted by name so lookups can binary search the mapping, and each one points at a run of levels.
+	static constexpr u32 PACK_MAGIC = 0x50585450; // 'PTXP'
+	static constexpr u32 PACK_VERSION = 1;
+	static constexpr u32 PACK_DATA_ALIGNMENT = 64;
+
+	struct PackHeader
+	{
+		u32 magic;
+		u32 version;
+		u32 entry_count;
+		u32 level_count;
+		u64 entries_offset;
+		u64 levels_offset;
+		u64 file_size;
+	};
+
+	struct PackEntry
+	{
+		TextureName name;
+		u8 format; // GSTexture::Format
+		u8 alpha_min;
+		u8 alpha_max;
+		u8 level_count;
+		u32 first_level;
+	};
+
+	struct PackLevel
+	{
+		u32 width;
+		u32 height;
+		u32 pitch;
+		u32 pad;
+		u64 offset;
+		u64 size;
+	};
+
+	static_assert(sizeof(TextureName) == 32 && sizeof(PackHeader) == 40 && sizeof(PackEntry) == 40 && sizeof(PackLevel) == 32,
+		"Replacement pack structures are written as-is");
 } // namespace
 
 namespace std
@@ -110,6 +165,7 @@ namespace GSTextureReplacements
 	static GSTextureCache::HashCacheKey HashCacheKeyFromTextureName(const TextureName& tn);
 	static std::optional<TextureName> ParseReplacementName(const std::string& filename);
 	static std::string GetGameTextureDirectory();
+	static void ScanReplacementDirectory(const std::string& dir, std::unordered_map<TextureName, std::string>* names);
 	template <GSTexture::Format format>
 	std::pair<u8, u8> GetBCAlphaMinMax(ReplacementTexture& rtex);
 	static void SetReplacementTextureAlphaMinMax(ReplacementTexture& rtex);
@@ -118,6 +174,12 @@ namespace GSTextureReplacements
 	static void PrecacheReplacementTextures();
 	static void ClearReplacementTextures();
 
+	static bool OpenReplacementPack(const std::string& path);
+	static void CloseReplacementPack();
+	static GSTexture* LookupPackTexture(const TextureName& name, bool mipmap, std::pair<u8, u8>* alpha_minmax);
+	static void GenerateReplacementMips(ReplacementTexture& rtex);
+	static bool WarnIfCompressedWithoutMips(GSTexture::Format format, bool has_mips);
+
 	static void StartWorkerThread();
 	static void StopWorkerThread();
 	static void QueueWorkerThreadItem(std::function<void()> fn, bool high_priority);
@@ -150,6 +212,23 @@ namespace GSTextureReplacements
 	static std::condition_variable s_worker_thread_cv;
 	static std::deque<std::pair<std::function<void()>, bool>> s_worker_thread_queue;
 	static bool s_worker_thread_running = false;
+
+	/// Replacement pack for the current game, used instead of the loose files when present.
+	/// Points either into a file mapping or into s_pack_buffer when the file couldn't be mapped.
+	static const u8* s_pack_data = nullptr;
+	static size_t s_pack_size = 0;
+	static std::vector<u8> s_pack_buffer;
+#ifdef _WIN32
+	static HANDLE s_pack_mapping = nullptr;
+#endif
+	static const PackEntry* s_pack_entries = nullptr;
+	static const PackLevel* s_pack_levels = nullptr;
+	static u32 s_pack_entry_count = 0;
+
+	/// Pack lookups only happen on the GS thread.
+	static u64 s_pack_lookups = 0;
+	static u64 s_pack_hits = 0;
+	static u64 s_pack_lookup_ticks = 0;
 }; // namespace GSTextureReplacements
 
 TextureName GSTextureReplacements::CreateTextureName(const GSTextureCache::HashCacheKey& hash, u32 miplevel)
@@ -262,6 +341,29 @@ std::string GSTextureReplacements::GetGameTextureDirectory()
 	return Path::Combine(EmuFolders::Textures, s_current_serial);
 }
 
+void GSTextureReplacements::ScanReplacementDirectory(const std::string& dir, std::unordered_map<TextureName, std::string>* names)
+{
+	FileSystem::FindResultsArray files;
+	if (!FileSystem::FindFiles(dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &files))
+		return;
+
+	std::string filename;
+	for (FILESYSTEM_FIND_DATA& fd : files)
+	{
+		// file format we can handle?
+		filename = Path::GetFileName(fd.FileName);
+		if (!GetLoader(filename.c_str()))
+			continue;
+
+		// parse the name if it's valid
+		std::optional<TextureName> name = ParseReplacementName(filename);
+		if (!name.has_value())
+			continue;
+
+		names->emplace(name.value(), std::move(fd.FileName));
+	}
+}
+
 void GSTextureReplacements::Initialize()
 {
 	s_current_serial = VMManager::GetDiscSerial();
@@ -287,47 +389,37 @@ void GSTextureReplacements::ReloadReplacementMap()
 	SyncWorkerThread();
 
 	// clear out the caches
-	{
-		s_replacement_texture_filenames.clear();
-		s_replacement_textures_without_clut_hash.clear();
-
-		std::unique_lock<std::mutex> lock(s_replacement_texture_cache_mutex);
-		s_replacement_texture_cache.clear();
-		s_pending_async_load_textures.clear();
-		s_async_loaded_textures.clear();
-	}
+	ClearReplacementTextures();
 
 	// can't replace bios textures.
 	if (s_current_serial.empty() || !GSConfig.LoadTextureReplacements)
 		return;
 
-	const std::string replacement_dir(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME));
-
-	FileSystem::FindResultsArray files;
-	if (!FileSystem::FindFiles(replacement_dir.c_str(), "*", FILESYSTEM_FIND_FILES | FILESYSTEM_FIND_HIDDEN_FILES | FILESYSTEM_FIND_RECURSIVE, &files))
-		return;
-
-	std::string filename;
-	for (FILESYSTEM_FIND_DATA& fd : files)
+	// a pack takes over from the loose files, delete it to go back to them
+	if (OpenReplacementPack(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_PACK_NAME)))
 	{
-		// file format we can handle?
-		filename = Path::GetFileName(fd.FileName);
-		if (!GetLoader(filename.c_str()))
-			continue;
-
-		// parse the name if it's valid
-		std::optional<TextureName> name = ParseReplacementName(filename);
-		if (!name.has_value())
-			continue;
-
-		s_replacement_texture_filenames.emplace(name.value(), std::move(fd.FileName));
+		for (u32 i = 0; i < s_pack_entry_count; i++)
+		{
+			TextureName name = s_pack_entries[i].name;
+			name.CLUTHash = 0;
+			s_replacement_textures_without_clut_hash.insert(name);
+		}
+	}
+	else
+	{
+		ScanReplacementDirectory(Path::Combine(GetGameTextureDirectory(), TEXTURE_REPLACEMENT_SUBDIRECTORY_NAME),
+			&s_replacement_texture_filenames);
 
 		// zero out the CLUT hash, because we need this for checking if there's any replacements with this hash when using paltex
-		name->CLUTHash = 0;
-		s_replacement_textures_without_clut_hash.insert(name.value());
+		for (const auto& it : s_replacement_texture_filenames)
+		{
+			TextureName name = it.first;
+			name.CLUTHash = 0;
+			s_replacement_textures_without_clut_hash.insert(name);
+		}
 	}
 
-	if (!s_replacement_texture_filenames.empty())
+	if (HasAnyReplacementTextures())
 	{
 		if (GSConfig.PrecacheTextureReplacements)
 			PrecacheReplacementTextures();
@@ -376,7 +468,7 @@ u32 GSTextureReplacements::CalcMipmapLevelsForReplacement(u32 width, u32 height)
 
 bool GSTextureReplacements::HasAnyReplacementTextures()
 {
-	return !s_replacement_texture_filenames.empty();
+	return !s_replacement_texture_filenames.empty() || s_pack_entry_count > 0;
 }
 
 bool GSTextureReplacements::HasReplacementTextureWithOtherPalette(const GSTextureCache::HashCacheKey& hash)
@@ -391,6 +483,10 @@ GSTexture* GSTextureReplacements::LookupReplacementTexture(const GSTextureCache:
 	const TextureName name(CreateTextureName(hash, 0));
 	*pending = false;
 
+	// packs are already decoded, so there's nothing to wait for
+	if (s_pack_data)
+		return LookupPackTexture(name, mipmap, alpha_minmax);
+
 	// replacement for this name exists?
 	auto fnit = s_replacement_texture_filenames.find(name);
 	if (fnit == s_replacement_texture_filenames.end())
@@ -599,6 +695,7 @@ void GSTextureReplacements::PrecacheReplacementTextures()
 
 void GSTextureReplacements::ClearReplacementTextures()
 {
+	CloseReplacementPack();
 	s_replacement_texture_filenames.clear();
 	s_replacement_textures_without_clut_hash.clear();
 
@@ -608,23 +705,29 @@ void GSTextureReplacements::ClearReplacementTextures()
 	s_async_loaded_textures.clear();
 }
 
-GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementTexture& rtex, bool mipmap)
+bool GSTextureReplacements::WarnIfCompressedWithoutMips(GSTexture::Format format, bool has_mips)
 {
 	// can't use generated mipmaps with compressed formats, because they can't be rendered to
 	// in the future I guess we could decompress the dds and generate them... but there's no reason that modders can't generate mips in dds
-	if (mipmap && GSTexture::IsCompressedFormat(rtex.format) && rtex.mips.empty())
+	if (!GSTexture::IsCompressedFormat(format) || has_mips)
+		return false;
+
+	static bool log_once = false;
+	if (!log_once)
 	{
-		static bool log_once = false;
-		if (!log_once)
-		{
-			static const char* message =
-				"Disabling autogenerated mipmaps on one or more compressed replacement textures. Please generate mipmaps when compressing your textures.";
-			Console.Warning(message);
-			log_once = true;
-		}
+		static const char* message =
+			"Disabling autogenerated mipmaps on one or more compressed replacement textures. Please generate mipmaps when compressing your textures.";
+		Console.Warning(message);
+		log_once = true;
+	}
+
+	return true;
+}
 
+GSTexture* GSTextureReplacements::CreateReplacementTexture(const ReplacementTexture& rtex, bool mipmap)
+{
+	if (mipmap && WarnIfCompressedWithoutMips(rtex.format, !rtex.mips.empty()))
 		mipmap = false;
-	}
 
 	GSTexture* tex = g_gs_device->CreateTexture(rtex.width, rtex.height, static_cast<int>(rtex.mips.size()) + 1, rtex.format);
 	if (!tex)
@@ -677,6 +780,317 @@ void GSTextureReplacements::ProcessAsyncLoadedTextures()
 	s_async_loaded_textures.clear();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Replacement Packs
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GSTextureReplacements::OpenReplacementPack(const std::string& path)
+{
+	struct stat st;
+	if (!FileSystem::StatFile(path.c_str(), &st) || st.st_size <= 0)
+		return false;
+
+	const u64 start = Common::Timer::GetCurrentValue();
+	s_pack_size = static_cast<size_t>(st.st_size);
+
+	// Map the pack so only the textures the game actually uses get paged in.
+#ifdef _WIN32
+	const int fd = FileSystem::OpenFDFile(path.c_str(), _O_RDONLY | _O_BINARY, 0);
+	if (fd >= 0)
+	{
+		s_pack_mapping = CreateFileMapping(reinterpret_cast<HANDLE>(_get_osfhandle(fd)), nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (s_pack_mapping)
+		{
+			s_pack_data = static_cast<const u8*>(MapViewOfFile(s_pack_mapping, FILE_MAP_READ, 0, 0, 0));
+			if (!s_pack_data)
+			{
+				CloseHandle(s_pack_mapping);
+				s_pack_mapping = nullptr;
+			}
+		}
+		_close(fd);
+	}
+#else
+	const int fd = FileSystem::OpenFDFile(path.c_str(), O_RDONLY, 0);
+	if (fd >= 0)
+	{
+		void* map = mmap(nullptr, s_pack_size, PROT_READ, MAP_SHARED, fd, 0);
+		s_pack_data = (map != MAP_FAILED) ? static_cast<const u8*>(map) : nullptr;
+		close(fd);
+	}
+#endif
+
+	if (!s_pack_data)
+	{
+		// e.g. no address space for it on 32bit, the whole thing has to come in then.
+		std::optional<std::vector<u8>> data(FileSystem::ReadBinaryFile(path.c_str()));
+		if (!data.has_value() || data->size() != s_pack_size)
+		{
+			Console.Error("Failed to read replacement pack '%s'", path.c_str());
+			CloseReplacementPack();
+			return false;
+		}
+
+		s_pack_buffer = std::move(data.value());
+		s_pack_data = s_pack_buffer.data();
+	}
+
+	PackHeader header;
+	bool valid = (s_pack_size >= sizeof(header));
+	if (valid)
+	{
+		std::memcpy(&header, s_pack_data, sizeof(header));
+		valid = (header.magic == PACK_MAGIC && header.version == PACK_VERSION && header.file_size == s_pack_size &&
+				 header.entries_offset % alignof(PackEntry) == 0 && header.levels_offset % alignof(PackLevel) == 0 &&
+				 header.entries_offset <= s_pack_size && header.levels_offset <= s_pack_size &&
+				 header.entry_count <= (s_pack_size - header.entries_offset) / sizeof(PackEntry) &&
+				 header.level_count <= (s_pack_size - header.levels_offset) / sizeof(PackLevel));
+	}
+
+	if (valid)
+	{
+		s_pack_entries = reinterpret_cast<const PackEntry*>(s_pack_data + header.entries_offset);
+		s_pack_levels = reinterpret_cast<const PackLevel*>(s_pack_data + header.levels_offset);
+
+		// Check everything up front, so lookups can trust the offsets.
+		for (u32 i = 0; i < header.entry_count && valid; i++)
+		{
+			const PackEntry& entry = s_pack_entries[i];
+			valid = (entry.level_count > 0 && entry.format <= static_cast<u8>(GSTexture::Format::BC7) &&
+					 entry.first_level <= header.level_count && entry.level_count <= header.level_count - entry.first_level &&
+					 (i == 0 || s_pack_entries[i - 1].name < entry.name));
+
+			for (u32 j = 0; j < entry.level_count && valid; j++)
+			{
+				const PackLevel& level = s_pack_levels[entry.first_level + j];
+				const GSTexture::Format format = static_cast<GSTexture::Format>(entry.format);
+				const u64 rows = GSTexture::IsCompressedFormat(format) ? ((level.height + 3) / 4) : level.height;
+				valid = (level.width > 0 && level.height > 0 && level.offset <= s_pack_size &&
+						 level.size <= s_pack_size - level.offset && static_cast<u64>(level.pitch) * rows <= level.size);
+			}
+		}
+	}
+
+	if (!valid)
+	{
+		Console.Error("'%s' is not a valid replacement pack", path.c_str());
+		CloseReplacementPack();
+		return false;
+	}
+
+	s_pack_entry_count = header.entry_count;
+
+	Console.WriteLn("Loaded replacement pack '%s' with %u textures (%.1f MB) in %.2f ms", path.c_str(), s_pack_entry_count,
+		static_cast<double>(s_pack_size) / _1mb, Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start) * 1e3);
+	return true;
+}
+
+void GSTextureReplacements::CloseReplacementPack()
+{
+	if (s_pack_lookups > 0)
+	{
+		Console.WriteLn("Replacement pack: %llu lookups, %llu hits, %.2f us per lookup",
+			static_cast<unsigned long long>(s_pack_lookups), static_cast<unsigned long long>(s_pack_hits),
+			Common::Timer::ConvertValueToSeconds(s_pack_lookup_ticks) * 1e6 / static_cast<double>(s_pack_lookups));
+	}
+	s_pack_lookups = 0;
+	s_pack_hits = 0;
+	s_pack_lookup_ticks = 0;
+
+	if (s_pack_data && s_pack_buffer.empty())
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(s_pack_data);
+		CloseHandle(s_pack_mapping);
+		s_pack_mapping = nullptr;
+#else
+		munmap(const_cast<u8*>(s_pack_data), s_pack_size);
+#endif
+	}
+
+	std::vector<u8>().swap(s_pack_buffer);
+	s_pack_data = nullptr;
+	s_pack_size = 0;
+	s_pack_entries = nullptr;
+	s_pack_levels = nullptr;
+	s_pack_entry_count = 0;
+}
+
+GSTexture* GSTextureReplacements::LookupPackTexture(const TextureName& name, bool mipmap, std::pair<u8, u8>* alpha_minmax)
+{
+	const u64 start = Common::Timer::GetCurrentValue();
+	s_pack_lookups++;
+
+	const PackEntry* end = s_pack_entries + s_pack_entry_count;
+	const PackEntry* entry = std::lower_bound(s_pack_entries, end, name,
+		[](const PackEntry& lhs, const TextureName& rhs) { return lhs.name < rhs; });
+
+	GSTexture* tex = nullptr;
+	if (entry != end && entry->name == name)
+	{
+		const GSTexture::Format format = static_cast<GSTexture::Format>(entry->format);
+		if (mipmap && WarnIfCompressedWithoutMips(format, entry->level_count > 1))
+			mipmap = false;
+
+		// the levels are stored ready to go, straight from the mapping to the device
+		const PackLevel* levels = s_pack_levels + entry->first_level;
+		const u32 level_count = mipmap ? entry->level_count : 1;
+		tex = g_gs_device->CreateTexture(levels[0].width, levels[0].height, static_cast<int>(level_count), format);
+		if (tex)
+		{
+			for (u32 i = 0; i < level_count; i++)
+			{
+				const PackLevel& level = levels[i];
+				tex->Update(GSVector4i(0, 0, static_cast<int>(level.width), static_cast<int>(level.height)),
+					s_pack_data + level.offset, level.pitch, i);
+			}
+
+			*alpha_minmax = std::make_pair(entry->alpha_min, entry->alpha_max);
+			s_pack_hits++;
+		}
+	}
+
+	s_pack_lookup_ticks += Common::Timer::GetCurrentValue() - start;
+	return tex;
+}
+
+void GSTextureReplacements::GenerateReplacementMips(ReplacementTexture& rtex)
+{
+	// Plain 2x2 box filter, the same thing the device would do when generating them.
+	const u32 levels = CalcMipmapLevelsForReplacement(rtex.width, rtex.height);
+	rtex.mips.reserve(levels - 1);
+
+	const u8* src = rtex.data.data();
+	u32 src_width = rtex.width;
+	u32 src_height = rtex.height;
+	u32 src_pitch = rtex.pitch;
+	for (u32 i = 1; i < levels; i++)
+	{
+		ReplacementTexture::MipData mip;
+		mip.width = std::max(src_width / 2, 1u);
+		mip.height = std::max(src_height / 2, 1u);
+		mip.pitch = mip.width * sizeof(u32);
+		mip.data.resize(mip.pitch * mip.height);
+
+		for (u32 y = 0; y < mip.height; y++)
+		{
+			const u8* row0 = src + std::min(y * 2, src_height - 1) * src_pitch;
+			const u8* row1 = src + std::min(y * 2 + 1, src_height - 1) * src_pitch;
+			u8* out = mip.data.data() + y * mip.pitch;
+			for (u32 x = 0; x < mip.width; x++)
+			{
+				const u32 x0 = std::min(x * 2, src_width - 1) * sizeof(u32);
+				const u32 x1 = std::min(x * 2 + 1, src_width - 1) * sizeof(u32);
+				for (u32 c = 0; c < sizeof(u32); c++)
+					*(out++) = static_cast<u8>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
+			}
+		}
+
+		rtex.mips.push_back(std::move(mip));
+		src = rtex.mips.back().data.data();
+		src_width = rtex.mips.back().width;
+		src_height = rtex.mips.back().height;
+		src_pitch = rtex.mips.back().pitch;
+	}
+}
+
+bool GSTextureReplacements::BuildReplacementPack(const std::string& source_dir, const std::string& pack_path)
+{
+	const u64 start = Common::Timer::GetCurrentValue();
+
+	std::unordered_map<TextureName, std::string> files;
+	ScanReplacementDirectory(source_dir, &files);
+	if (files.empty())
+	{
+		Console.Error("No replacement textures found in '%s'", source_dir.c_str());
+		return false;
+	}
+
+	// sorted so lookups can binary search the pack in place
+	std::vector<std::pair<TextureName, std::string>> sorted(files.begin(), files.end());
+	std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+	const std::string temp_path(pack_path + ".tmp");
+	RFILE* fp = FileSystem::OpenFile(temp_path.c_str(), "wb");
+	if (!fp)
+	{
+		Console.Error("Failed to open '%s' for writing", temp_path.c_str());
+		return false;
+	}
+
+	static constexpr u8 padding[PACK_DATA_ALIGNMENT] = {};
+	u64 offset = 0;
+	bool ok = true;
+	const auto append = [&](const void* data, u64 size, u32 alignment) {
+		const u64 aligned = Common::AlignUpPow2(offset, alignment);
+		ok = ok && (aligned == offset || rfwrite(padding, 1, aligned - offset, fp) == static_cast<s64>(aligned - offset)) &&
+			 rfwrite(data, 1, size, fp) == static_cast<s64>(size);
+		offset = aligned + size;
+		return aligned;
+	};
+
+	PackHeader header = {};
+	append(&header, sizeof(header), 1);
+
+	std::vector<PackEntry> entries;
+	std::vector<PackLevel> levels;
+	entries.reserve(sorted.size());
+	u32 failed = 0;
+	for (const auto& [name, filename] : sorted)
+	{
+		std::optional<ReplacementTexture> rtex(LoadReplacementTexture(name, filename, false));
+		if (!rtex.has_value())
+		{
+			failed++;
+			continue;
+		}
+
+		// PNGs don't carry mips, so store the ones the device would have generated.
+		if (rtex->format == GSTexture::Format::Color && rtex->mips.empty())
+			GenerateReplacementMips(rtex.value());
+
+		PackEntry& entry = entries.emplace_back();
+		entry.name = name;
+		entry.format = static_cast<u8>(rtex->format);
+		entry.alpha_min = rtex->alpha_minmax.first;
+		entry.alpha_max = rtex->alpha_minmax.second;
+		entry.level_count = static_cast<u8>(rtex->mips.size() + 1);
+		entry.first_level = static_cast<u32>(levels.size());
+
+		PackLevel& base = levels.emplace_back();
+		base = {rtex->width, rtex->height, rtex->pitch, 0, 0, rtex->data.size()};
+		base.offset = append(rtex->data.data(), rtex->data.size(), PACK_DATA_ALIGNMENT);
+		for (const ReplacementTexture::MipData& mip : rtex->mips)
+		{
+			PackLevel& level = levels.emplace_back();
+			level = {mip.width, mip.height, mip.pitch, 0, 0, mip.data.size()};
+			level.offset = append(mip.data.data(), mip.data.size(), PACK_DATA_ALIGNMENT);
+		}
+	}
+
+	header.magic = PACK_MAGIC;
+	header.version = PACK_VERSION;
+	header.entry_count = static_cast<u32>(entries.size());
+	header.level_count = static_cast<u32>(levels.size());
+	header.entries_offset = append(entries.data(), entries.size() * sizeof(PackEntry), alignof(PackEntry));
+	header.levels_offset = append(levels.data(), levels.size() * sizeof(PackLevel), alignof(PackLevel));
+	header.file_size = offset;
+
+	ok = ok && rfseek(fp, 0, SEEK_SET) == 0 && rfwrite(&header, 1, sizeof(header), fp) == static_cast<s64>(sizeof(header));
+	ok = (rfclose(fp) == 0) && ok;
+	if (!ok || !FileSystem::RenamePath(temp_path.c_str(), pack_path.c_str()))
+	{
+		Console.Error("Failed to write replacement pack '%s'", pack_path.c_str());
+		FileSystem::DeleteFilePath(temp_path.c_str());
+		return false;
+	}
+
+	Console.WriteLn("Packed %zu replacement textures (%u failed) into '%s', %.1f MB in %.2f s", entries.size(), failed,
+		pack_path.c_str(), static_cast<double>(offset) / _1mb,
+		Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start));
+	return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Worker Thread
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
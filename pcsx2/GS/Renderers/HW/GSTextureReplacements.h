@@ -55,6 +55,10 @@ namespace GSTextureReplacements
 	GSTexture* CreateReplacementTexture(const ReplacementTexture& rtex, bool mipmap);
 	void ProcessAsyncLoadedTextures();
 
+	/// Converts a directory of loose replacements into a pack, which is loaded in their place
+	/// when it's saved as replacements.pack in the game's texture directory.
+	bool BuildReplacementPack(const std::string& source_dir, const std::string& pack_path);
+
 	/// Loader will take a filename and interpret the format (e.g. DDS, PNG, etc).
 	using ReplacementTextureLoader = bool (*)(const std::string& filename, GSTextureReplacements::ReplacementTexture* tex, bool only_base_image);
 	ReplacementTextureLoader GetLoader(const char *filename);
@@ -0,0 +1,225 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "common/Console.h"
+
+#include "GSDeviceNull.h"
+
+GSTextureNull::GSTextureNull(Type type, int width, int height, int levels, Format format)
+{
+	m_type = type;
+	m_format = format;
+	m_size.x = width;
+	m_size.y = height;
+	m_mipmap_levels = levels;
+}
+
+GSTextureNull::~GSTextureNull() = default;
+
+bool GSTextureNull::Update(const GSVector4i& r, const void* data, int pitch, int layer)
+{
+	GSDeviceNull::GetInstance()->CountUpload();
+	return true;
+}
+
+bool GSTextureNull::Map(GSMap& m, const GSVector4i* r, int layer)
+{
+	// Callers fall back to Update(), which keeps the CPU work (unswizzling etc) the same.
+	return false;
+}
+
+void GSTextureNull::Unmap()
+{
+}
+
+GSDownloadTextureNull::GSDownloadTextureNull(u32 width, u32 height, GSTexture::Format format)
+	: GSDownloadTexture(width, height, format)
+	, m_buffer(GetBufferSize(width, height, format))
+{
+	m_map_pointer = m_buffer.data();
+}
+
+GSDownloadTextureNull::~GSDownloadTextureNull() = default;
+
+void GSDownloadTextureNull::CopyFromTexture(
+	const GSVector4i& drc, GSTexture* stex, const GSVector4i& src, u32 src_level, bool use_transfer_pitch)
+{
+	m_current_pitch = GetTransferPitch(use_transfer_pitch ? static_cast<u32>(drc.width()) : m_width, 1);
+	m_needs_flush = false;
+	GSDeviceNull::GetInstance()->CountReadback();
+}
+
+bool GSDownloadTextureNull::Map(const GSVector4i& read_rc)
+{
+	return true;
+}
+
+void GSDownloadTextureNull::Unmap()
+{
+}
+
+void GSDownloadTextureNull::Flush()
+{
+}
+
+GSDeviceNull::GSDeviceNull() = default;
+
+GSDeviceNull::~GSDeviceNull() = default;
+
+GSDeviceNull::Counters GSDeviceNull::GetTotalCounters() const
+{
+	Counters total = m_total;
+	total.draws += m_frame.draws;
+	total.textures_created += m_frame.textures_created;
+	total.texture_bytes += m_frame.texture_bytes;
+	total.uploads += m_frame.uploads;
+	total.copies += m_frame.copies;
+	total.readbacks += m_frame.readbacks;
+	return total;
+}
+
+bool GSDeviceNull::Create()
+{
+	if (!GSDevice::Create())
+		return false;
+
+	// Claim what the common backends have, so the renderer takes its usual paths.
+	m_features.vs_expand = true;
+	m_features.primitive_id = true;
+	m_features.texture_barrier = true;
+	m_features.provoking_vertex_last = true;
+	m_features.point_expand = true;
+	m_features.line_expand = true;
+	m_features.clip_control = true;
+	m_features.stencil_buffer = true;
+	m_features.test_and_sample_depth = true;
+
+	m_frame = {};
+	m_last_frame = {};
+	m_total = {};
+	return true;
+}
+
+void GSDeviceNull::Destroy()
+{
+	const Counters total = GetTotalCounters();
+	if (total.frames > 0)
+	{
+		const double frames = static_cast<double>(total.frames);
+		Console.WriteLn("Null GS device: %llu frames, per frame %.1f draws, %.1f textures created (%.1f KB), "
+						"%.1f uploads, %.1f copies, %.1f readbacks",
+			static_cast<unsigned long long>(total.frames), total.draws / frames, total.textures_created / frames,
+			total.texture_bytes / frames / 1024.0, total.uploads / frames, total.copies / frames, total.readbacks / frames);
+	}
+
+	GSDevice::Destroy();
+}
+
+RenderAPI GSDeviceNull::GetRenderAPI() const
+{
+	return RenderAPI::None;
+}
+
+GSDevice::PresentResult GSDeviceNull::BeginPresent(bool frame_skip)
+{
+	return PresentResult::OK;
+}
+
+void GSDeviceNull::EndPresent()
+{
+	m_frame.frames = 1;
+	m_last_frame = m_frame;
+
+	m_total.frames++;
+	m_total.draws += m_frame.draws;
+	m_total.textures_created += m_frame.textures_created;
+	m_total.texture_bytes += m_frame.texture_bytes;
+	m_total.uploads += m_frame.uploads;
+	m_total.copies += m_frame.copies;
+	m_total.readbacks += m_frame.readbacks;
+
+	m_frame = {};
+}
+
+GSTexture* GSDeviceNull::CreateSurface(GSTexture::Type type, int width, int height, int levels, GSTexture::Format format)
+{
+	GSTextureNull* tex = new GSTextureNull(type, width, height, levels, format);
+	m_frame.textures_created++;
+	m_frame.texture_bytes += tex->GetMemUsage();
+	return tex;
+}
+
+std::unique_ptr<GSDownloadTexture> GSDeviceNull::CreateDownloadTexture(u32 width, u32 height, GSTexture::Format format)
+{
+	return std::make_unique<GSDownloadTextureNull>(width, height, format);
+}
+
+void GSDeviceNull::DoMerge(GSTexture* sTex[3], GSVector4* sRect, GSTexture* dTex, GSVector4* dRect, const GSRegPMODE& PMODE, const GSRegEXTBUF& EXTBUF, u32 c, const bool linear)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::DoInterlace(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, ShaderInterlace shader, bool linear, const InterlaceConstantBuffer& cb)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::CopyRect(GSTexture* sTex, GSTexture* dTex, const GSVector4i& r, u32 destX, u32 destY)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::StretchRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, ShaderConvert shader, bool linear)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::StretchRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, bool red, bool green, bool blue, bool alpha, ShaderConvert shader)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::PresentRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect)
+{
+}
+
+void GSDeviceNull::DrawMultiStretchRects(const MultiStretchRect* rects, u32 num_rects, GSTexture* dTex, ShaderConvert shader)
+{
+	m_frame.copies += num_rects;
+}
+
+void GSDeviceNull::UpdateCLUTTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, GSTexture* dTex, u32 dOffset, u32 dSize)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::ConvertToIndexedTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, u32 SBW, u32 SPSM, GSTexture* dTex, u32 DBW, u32 DPSM)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32 downsample_factor, const GSVector2i& clamp_min, const GSVector4& dRect)
+{
+	m_frame.copies++;
+}
+
+void GSDeviceNull::RenderHW(GSHWDrawConfig& config)
+{
+	m_frame.draws++;
+}
+
+void GSDeviceNull::ClearSamplerCache()
+{
+}
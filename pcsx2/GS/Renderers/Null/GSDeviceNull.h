@@ -0,0 +1,116 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../Common/GSDevice.h"
+
+#include <vector>
+
+// Textures only remember their size and format, there's nothing behind them.
+class GSTextureNull final : public GSTexture
+{
+public:
+	GSTextureNull(Type type, int width, int height, int levels, Format format);
+	~GSTextureNull() override;
+
+	bool Update(const GSVector4i& r, const void* data, int pitch, int layer = 0) override;
+	bool Map(GSMap& m, const GSVector4i* r = NULL, int layer = 0) override;
+	void Unmap() override;
+};
+
+class GSDownloadTextureNull final : public GSDownloadTexture
+{
+public:
+	GSDownloadTextureNull(u32 width, u32 height, GSTexture::Format format);
+	~GSDownloadTextureNull() override;
+
+	void CopyFromTexture(const GSVector4i& drc, GSTexture* stex, const GSVector4i& src, u32 src_level, bool use_transfer_pitch) override;
+
+	bool Map(const GSVector4i& read_rc) override;
+	void Unmap() override;
+
+	void Flush() override;
+
+private:
+	/// Readbacks come out as zeroes.
+	std::vector<u8> m_buffer;
+};
+
+// Accepts everything the hardware renderer asks for and draws nothing, so the CPU side of
+// the hardware renderer (texture cache, vertex processing, draw setup) can be run and
+// profiled on a machine without a GPU.
+class GSDeviceNull final : public GSDevice
+{
+public:
+	struct Counters
+	{
+		u64 frames;            ///< frames presented
+		u64 draws;             ///< RenderHW calls
+		u64 textures_created;  ///< surfaces created, pool hits aren't counted
+		u64 texture_bytes;     ///< memory those surfaces would have taken
+		u64 uploads;           ///< texture updates from the CPU
+		u64 copies;            ///< copies, stretches and conversions between textures
+		u64 readbacks;         ///< copies from textures back to the CPU
+	};
+
+	GSDeviceNull();
+	~GSDeviceNull() override;
+
+	__fi static GSDeviceNull* GetInstance() { return static_cast<GSDeviceNull*>(g_gs_device.get()); }
+
+	/// Counters for the last presented frame.
+	__fi const Counters& GetFrameCounters() const { return m_last_frame; }
+
+	/// Counters since the device was created, the current frame included.
+	Counters GetTotalCounters() const;
+
+	__fi void CountUpload() { m_frame.uploads++; }
+	__fi void CountReadback() { m_frame.readbacks++; }
+
+	bool Create() override;
+	void Destroy() override;
+
+	RenderAPI GetRenderAPI() const override;
+
+	PresentResult BeginPresent(bool frame_skip) override;
+	void EndPresent() override;
+
+	std::unique_ptr<GSDownloadTexture> CreateDownloadTexture(u32 width, u32 height, GSTexture::Format format) override;
+
+	void CopyRect(GSTexture* sTex, GSTexture* dTex, const GSVector4i& r, u32 destX, u32 destY) override;
+	void StretchRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, ShaderConvert shader = ShaderConvert::COPY, bool linear = true) override;
+	void StretchRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, bool red, bool green, bool blue, bool alpha, ShaderConvert shader = ShaderConvert::COPY) override;
+	void PresentRect(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect) override;
+	void DrawMultiStretchRects(const MultiStretchRect* rects, u32 num_rects, GSTexture* dTex, ShaderConvert shader) override;
+	void UpdateCLUTTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, GSTexture* dTex, u32 dOffset, u32 dSize) override;
+	void ConvertToIndexedTexture(GSTexture* sTex, float sScale, u32 offsetX, u32 offsetY, u32 SBW, u32 SPSM, GSTexture* dTex, u32 DBW, u32 DPSM) override;
+	void FilteredDownsampleTexture(GSTexture* sTex, GSTexture* dTex, u32 downsample_factor, const GSVector2i& clamp_min, const GSVector4& dRect) override;
+
+	void RenderHW(GSHWDrawConfig& config) override;
+
+	void ClearSamplerCache() override;
+
+protected:
+	GSTexture* CreateSurface(GSTexture::Type type, int width, int height, int levels, GSTexture::Format format) override;
+
+	void DoMerge(GSTexture* sTex[3], GSVector4* sRect, GSTexture* dTex, GSVector4* dRect, const GSRegPMODE& PMODE, const GSRegEXTBUF& EXTBUF, u32 c, const bool linear) override;
+	void DoInterlace(GSTexture* sTex, const GSVector4& sRect, GSTexture* dTex, const GSVector4& dRect, ShaderInterlace shader, bool linear, const InterlaceConstantBuffer& cb) override;
+
+private:
+	Counters m_frame = {};
+	Counters m_last_frame = {};
+	Counters m_total = {};
+};
@@ -0,0 +1,32 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../Common/GSRenderer.h"
+
+// Runs the whole GS front end (GIF parsing, vertex kicks, local memory transfers)
+// but throws every draw away. Used to measure the front end on its own.
+class GSRendererNull final : public GSRenderer
+{
+protected:
+	GSTexture* GetOutput(int i, float& scale, int& y_offset) override;
+
+public:
+	GSRendererNull();
+	~GSRendererNull() override;
+
+	void Draw() override;
+};
@@ -86,6 +86,8 @@ class GLProgram
 		__fi bool operator==(const GLProgram& rhs) const { return m_program_id == rhs.m_program_id; }
 		__fi bool operator!=(const GLProgram& rhs) const { return m_program_id != rhs.m_program_id; }
 
+		__fi bool IsValid() const { return m_program_id != 0; }
+
 	private:
 		GLuint m_program_id = 0;
 		GLuint m_vertex_shader_id = 0;
@@ -1811,14 +1811,11 @@ __fi static void WriteToStreamBuffer(GLStreamBuffer* sb, u32 index, u32 align, c
 	glBindBufferRange(GL_UNIFORM_BUFFER, index, sb->GetGLBufferId(), res.buffer_offset, size);
 }
 
-void GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
+GLProgram& GSDeviceOGL::GetProgram(const ProgramSelector& psel)
 {
 	auto it = m_programs.find(psel);
 	if (it != m_programs.end())
-	{
-		it->second.Bind();
-		return;
-	}
+		return it->second;
 
 	const std::string vs(GetVSSource(psel.vs));
 	const std::string ps(GetPSSource(psel.ps));
@@ -1826,7 +1823,30 @@ void GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
 	GLProgram prog;
 	m_shader_cache.GetProgram(&prog, vs, ps);
 	it = m_programs.emplace(psel, std::move(prog)).first;
-	it->second.Bind();
+	m_pipeline_usage_log.Record(&psel);
+	return it->second;
+}
+
+void GSDeviceOGL::SetupPipeline(const ProgramSelector& psel)
+{
+	GetProgram(psel).Bind();
+}
+
+u32 GSDeviceOGL::GetPipelineUsageKeySize() const
+{
+	// Only up to the padding, the rest of the selector isn't always cleared.
+	return offsetof(ProgramSelector, pad);
+}
+
+bool GSDeviceOGL::PrewarmPipeline(const void* key)
+{
+	// The key is the selector up to its padding, see GetPipelineUsageKeySize().
+	const u8* data = static_cast<const u8*>(key);
+	ProgramSelector psel{};
+	std::memcpy(&psel.ps.key_lo, data + offsetof(ProgramSelector, ps), sizeof(psel.ps.key_lo));
+	std::memcpy(&psel.ps.key_hi, data + offsetof(ProgramSelector, ps) + sizeof(psel.ps.key_lo), sizeof(psel.ps.key_hi));
+	std::memcpy(&psel.vs.key, data + offsetof(ProgramSelector, vs), sizeof(psel.vs.key));
+	return GetProgram(psel).IsValid();
 }
 
 void GSDeviceOGL::SetupSampler(PSSamplerSelector ssel)
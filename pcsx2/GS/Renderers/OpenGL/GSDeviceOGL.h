@@ -250,6 +250,9 @@ public:
 
 	RenderAPI GetRenderAPI() const override;
 
+	u32 GetPipelineUsageKeySize() const override;
+	bool PrewarmPipeline(const void* key) override;
+
 	bool Create() override;
 	void Destroy() override;
 
@@ -316,6 +319,7 @@ public:
 	GLuint CreateSampler(PSSamplerSelector sel);
 	GSDepthStencilOGL* CreateDepthStencil(OMDepthStencilSelector dssel);
 
+	GLProgram& GetProgram(const ProgramSelector& psel);
 	void SetupPipeline(const ProgramSelector& psel);
 	void SetupSampler(PSSamplerSelector ssel);
 	void SetupOM(OMDepthStencilSelector dssel);
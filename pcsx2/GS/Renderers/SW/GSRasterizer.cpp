@@ -20,6 +20,8 @@
 #include "../../GSExtra.h"
 
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
+#include "common/Timer.h"
 
 #include "../../../VMManager.h"
 
@@ -115,6 +117,11 @@ int GSRasterizer::GetPixels(bool reset)
 }
 
 void GSRasterizer::Draw(GSRasterizerData& data)
+{
+	Draw(data, data.scissor);
+}
+
+void GSRasterizer::Draw(GSRasterizerData& data, const GSVector4i& clip)
 {
 	if ((data.vertex && data.vertex_count == 0) || (data.index && data.index_count == 0))
 		return;
@@ -135,11 +142,12 @@ void GSRasterizer::Draw(GSRasterizerData& data)
 
 	static constexpr u16 tmp_index[] = {0, 1, 2};
 
-	bool scissor_test = !data.bbox.eq(data.bbox.rintersect(data.scissor));
+	const GSVector4i scissor = data.scissor.rintersect(clip);
+	bool scissor_test = !data.bbox.eq(data.bbox.rintersect(scissor));
 
-	m_scissor = data.scissor;
-	m_fscissor_x = GSVector4(data.scissor).xzxz();
-	m_fscissor_y = GSVector4(data.scissor).ywyw();
+	m_scissor = scissor;
+	m_fscissor_x = GSVector4(scissor).xzxz();
+	m_fscissor_y = GSVector4(scissor).ywyw();
 	m_scanmsk_value = data.scanmsk_value;
 
 	switch (data.primclass)
@@ -1126,10 +1134,61 @@ int GSSingleRasterizer::GetPixels(bool reset /*= true*/)
 	return m_r.GetPixels(reset);
 }
 
+void GSRasterizerWorkerCounters::Reset(u64 now)
+{
+	busy.store(0, std::memory_order_relaxed);
+	jobs.store(0, std::memory_order_relaxed);
+	start.store(now, std::memory_order_relaxed);
+}
+
+void GSRasterizerWorkerCounters::Add(u64 begin, u64 end)
+{
+	busy.fetch_add(end - begin, std::memory_order_relaxed);
+	jobs.fetch_add(1, std::memory_order_relaxed);
+}
+
+GSRasterizerWorkerStats GSRasterizerWorkerCounters::Get(u64 now, bool reset)
+{
+	const u64 total = now - start.load(std::memory_order_relaxed);
+	const u64 busy_ticks = std::min(busy.load(std::memory_order_relaxed), total);
+
+	GSRasterizerWorkerStats stats;
+	stats.busy_ms = Common::Timer::ConvertValueToSeconds(busy_ticks) * 1000.0;
+	stats.idle_ms = Common::Timer::ConvertValueToSeconds(total - busy_ticks) * 1000.0;
+	stats.jobs = jobs.load(std::memory_order_relaxed);
+
+	if (reset)
+		Reset(now);
+
+	return stats;
+}
+
+static void LogWorkerStats(const char* name, IRasterizer& rl)
+{
+	std::vector<GSRasterizerWorkerStats> stats;
+	rl.GetWorkerStats(stats, false);
+
+	for (size_t i = 0; i < stats.size(); i++)
+	{
+		const double total = stats[i].busy_ms + stats[i].idle_ms;
+		if (stats[i].jobs == 0 || total <= 0.0)
+			continue;
+
+		Console.WriteLn("(GSRasterizer) %s worker %zu: %.1f%% busy, %llu jobs, %.3f ms per job", name, i,
+			stats[i].busy_ms * 100.0 / total, static_cast<unsigned long long>(stats[i].jobs),
+			stats[i].busy_ms / static_cast<double>(stats[i].jobs));
+	}
+}
+
 GSRasterizerList::GSRasterizerList(int threads)
+	: m_counters(new GSRasterizerWorkerCounters[threads])
 {
 	m_thread_height = compute_best_thread_height(threads);
 
+	const u64 now = Common::Timer::GetCurrentValue();
+	for (int i = 0; i < threads; i++)
+		m_counters[i].Reset(now);
+
 	const int rows = (2048 >> m_thread_height) + 16;
 	m_scanline = static_cast<u8*>(_aligned_malloc(rows, 64));
 
@@ -1139,6 +1198,10 @@ GSRasterizerList::GSRasterizerList(int threads)
 
 GSRasterizerList::~GSRasterizerList()
 {
+	LogWorkerStats("Banded", *this);
+
+	// Stop the workers before the rasterizers and counters they use go away.
+	m_workers.clear();
 	_aligned_free(m_scanline);
 }
 
@@ -1217,6 +1280,15 @@ int GSRasterizerList::GetPixels(bool reset)
 	return pixels;
 }
 
+void GSRasterizerList::GetWorkerStats(std::vector<GSRasterizerWorkerStats>& stats, bool reset)
+{
+	const u64 now = Common::Timer::GetCurrentValue();
+
+	stats.resize(m_workers.size());
+	for (size_t i = 0; i < m_workers.size(); i++)
+		stats[i] = m_counters[i].Get(now, reset);
+}
+
 std::unique_ptr<IRasterizer> GSRasterizerList::Create(int threads)
 {
 	threads = std::max<int>(threads, 0);
@@ -1224,16 +1296,303 @@ std::unique_ptr<IRasterizer> GSRasterizerList::Create(int threads)
 	if (threads == 0)
 		return std::make_unique<GSSingleRasterizer>();
 
+	if (GSConfig.SWWorkStealing)
+		return GSWorkStealingRasterizerList::Create(threads);
+
 	std::unique_ptr<GSRasterizerList> rl(new GSRasterizerList(threads));
 
 	for (int i = 0; i < threads; i++)
 	{
 		rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(&rl->m_ds, i, threads)));
 		auto& r = *rl->m_r[i];
+		auto& counters = rl->m_counters[i];
 		rl->m_workers.push_back(std::unique_ptr<GSWorker>(new GSWorker([i]() { GSRasterizerList::OnWorkerStartup(i); },
-			[&r](GSRingHeap::SharedPtr<GSRasterizerData>& item) { r.Draw(*item.get()); },
+			[&r, &counters](GSRingHeap::SharedPtr<GSRasterizerData>& item) {
+				const u64 begin = Common::Timer::GetCurrentValue();
+				r.Draw(*item.get());
+				counters.Add(begin, Common::Timer::GetCurrentValue());
+			},
 			[i]() { GSRasterizerList::OnWorkerShutdown(i); })));
 	}
 
 	return rl;
 }
+
+//
+
+GSWorkStealingRasterizerList::GSWorkStealingRasterizerList(int threads)
+{
+	m_thread_height = compute_best_thread_height(threads);
+
+	// One spare tile for draws whose bottom edge sits exactly on the 2048 line.
+	m_tile_count = (2048 >> m_thread_height) + 1;
+	m_ready_words = (m_tile_count + 31) / 32;
+
+	m_tiles.reset(new Tile[m_tile_count]);
+	for (int i = 0; i < m_tile_count; i++)
+		m_tiles[i].rect = GSVector4i(0, i << m_thread_height, 2048, (i + 1) << m_thread_height);
+
+	m_ready.reset(new std::atomic<u32>[m_ready_words]);
+	for (int i = 0; i < m_ready_words; i++)
+		m_ready[i].store(0, std::memory_order_relaxed);
+}
+
+GSWorkStealingRasterizerList::~GSWorkStealingRasterizerList()
+{
+	LogWorkerStats("Work stealing", *this);
+
+	m_exit = true;
+	for (auto& worker : m_workers)
+	{
+		worker->sema.NotifyOfWork();
+		worker->thread.join();
+	}
+}
+
+void GSWorkStealingRasterizerList::WorkerThread(int i)
+{
+	GSRasterizerList::OnWorkerStartup(i);
+
+	Worker& worker = *m_workers[i];
+
+	for (;;)
+	{
+		worker.sema.WaitForWork();
+		if (m_exit)
+			break;
+
+		int tile, count;
+		while ((tile = ClaimTiles(i, &count)) >= 0)
+		{
+			const u64 begin = Common::Timer::GetCurrentValue();
+			DrainTiles(i, tile, count);
+			worker.counters.Add(begin, Common::Timer::GetCurrentValue());
+		}
+	}
+
+	GSRasterizerList::OnWorkerShutdown(i);
+}
+
+int GSWorkStealingRasterizerList::ClaimTiles(int i, int* count)
+{
+	// Workers start looking at different parts of the screen, so they don't all fight
+	// over the first ready tile.
+	const int first = (i * m_ready_words) / static_cast<int>(m_workers.size());
+
+	for (int n = 0; n < m_ready_words; n++)
+	{
+		const int word = (first + n) % m_ready_words;
+		u32 bits = m_ready[word].load(std::memory_order_acquire);
+
+		while (bits != 0)
+		{
+			unsigned long bit;
+			_BitScanForward(&bit, bits);
+
+			// Take the ready tiles following this one as well, a draw covering several of
+			// them then only goes through setup once.
+			unsigned long len = 32;
+			const u32 rest = ~(bits >> bit);
+			if (rest != 0)
+				_BitScanForward(&len, rest);
+			len = std::min<unsigned long>(len, MAX_BATCH_TILES);
+
+			const u32 mask = ((1U << len) - 1) << bit;
+
+			if (m_ready[word].compare_exchange_weak(bits, bits & ~mask, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				// More tiles than we can take, get another worker going on them.
+				if ((bits & ~mask) != 0)
+					Notify();
+
+				*count = static_cast<int>(len);
+				return word * 32 + static_cast<int>(bit);
+			}
+		}
+	}
+
+	return -1;
+}
+
+void GSWorkStealingRasterizerList::DrainTiles(int i, int first, int count)
+{
+	GSRasterizer& r = *m_r[i];
+	const int end = first + count;
+	u32 owned = (1U << count) - 1; // bit n is tile first + n
+
+	while (owned != 0)
+	{
+		// Every tile keeps its own queue in order, the tiles don't need to agree with each other
+		// since they cover different pixels. A draw at the front of several adjacent tiles is
+		// drawn once over all of them instead of being set up again for each one.
+		for (;;)
+		{
+			bool drew = false;
+			bool prev_busy = false;
+
+			for (int tile = first; tile < end;)
+			{
+				Tile& t = m_tiles[tile];
+
+				if (!(owned & (1U << (tile - first))) || t.queue.empty())
+				{
+					prev_busy = false;
+					tile++;
+					continue;
+				}
+
+				std::atomic_thread_fence(std::memory_order_acquire);
+				GSRingHeap::SharedPtr<GSRasterizerData>& item = t.queue.front();
+
+				// The draw also covers the tile above, which still has older draws queued. Let that
+				// one catch up, so both have this draw at the front and it's drawn only once.
+				if (prev_busy && (item->bbox.rintersect(item->scissor).top >> m_thread_height) < tile)
+				{
+					tile++;
+					continue;
+				}
+
+				int n = 1;
+				while (tile + n < end && (owned & (1U << (tile + n - first))) && !m_tiles[tile + n].queue.empty())
+				{
+					std::atomic_thread_fence(std::memory_order_acquire);
+					if (m_tiles[tile + n].queue.front().get() != item.get())
+						break;
+					n++;
+				}
+
+				r.Draw(*item.get(), GSVector4i(0, tile << m_thread_height, 2048, (tile + n) << m_thread_height));
+
+				// item lives in the first tile's queue, so drop it last.
+				for (int j = tile + n - 1; j >= tile; j--)
+					m_tiles[j].queue.pop();
+				m_queued.fetch_sub(n, std::memory_order_release);
+
+				drew = true;
+				prev_busy = !m_tiles[tile + n - 1].queue.empty();
+				tile += n;
+			}
+
+			if (!drew)
+				break;
+		}
+
+		// Hand the tiles back. Queue() pushes before it checks the flag, and we clear the flag
+		// before we check the queue, so a draw pushed in between is seen by one side or the
+		// other; the exchange decides which of us gets to schedule it.
+		for (int tile = first; tile < end; tile++)
+		{
+			if (owned & (1U << (tile - first)))
+				m_tiles[tile].scheduled.store(false, std::memory_order_relaxed);
+		}
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		for (int tile = first; tile < end; tile++)
+		{
+			Tile& t = m_tiles[tile];
+			const u32 bit = 1U << (tile - first);
+			if ((owned & bit) && (t.queue.empty() || t.scheduled.exchange(true, std::memory_order_acq_rel)))
+				owned &= ~bit;
+		}
+	}
+}
+
+void GSWorkStealingRasterizerList::Notify()
+{
+	m_workers[m_next_worker.fetch_add(1, std::memory_order_relaxed) % m_workers.size()]->sema.NotifyOfWork();
+}
+
+void GSWorkStealingRasterizerList::Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data)
+{
+	GSVector4i r = data->bbox.rintersect(data->scissor);
+
+	if (unlikely(!m_ds.SetupDraw(*data.get())))
+	{
+		Sync();
+		m_ds.ResetCodeCache();
+		m_ds.SetupDraw(*data.get());
+	}
+
+	const int top = std::max(r.top >> m_thread_height, 0);
+	const int bottom = std::min((r.bottom + (1 << m_thread_height) - 1) >> m_thread_height, m_tile_count);
+
+	for (int i = top; i < bottom; i++)
+	{
+		Tile& t = m_tiles[i];
+
+		m_queued.fetch_add(1, std::memory_order_relaxed);
+
+		while (!t.queue.push(data))
+			std::this_thread::yield();
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		if (!t.scheduled.exchange(true, std::memory_order_acq_rel))
+		{
+			m_ready[i / 32].fetch_or(1U << (i % 32), std::memory_order_release);
+			Notify();
+		}
+	}
+}
+
+void GSWorkStealingRasterizerList::Sync()
+{
+	// A worker can wake another one after we have already waited for it, so go around
+	// again until every queued draw is done.
+	while (!IsSynced())
+	{
+		for (auto& worker : m_workers)
+			worker->sema.WaitForEmpty();
+	}
+}
+
+bool GSWorkStealingRasterizerList::IsSynced() const
+{
+	return m_queued.load(std::memory_order_acquire) == 0;
+}
+
+int GSWorkStealingRasterizerList::GetPixels(bool reset)
+{
+	int pixels = 0;
+
+	for (size_t i = 0; i < m_r.size(); i++)
+	{
+		pixels += m_r[i]->GetPixels(reset);
+	}
+
+	return pixels;
+}
+
+void GSWorkStealingRasterizerList::GetWorkerStats(std::vector<GSRasterizerWorkerStats>& stats, bool reset)
+{
+	const u64 now = Common::Timer::GetCurrentValue();
+
+	stats.resize(m_workers.size());
+	for (size_t i = 0; i < m_workers.size(); i++)
+		stats[i] = m_workers[i]->counters.Get(now, reset);
+}
+
+std::unique_ptr<IRasterizer> GSWorkStealingRasterizerList::Create(int threads)
+{
+	std::unique_ptr<GSWorkStealingRasterizerList> rl(new GSWorkStealingRasterizerList(threads));
+
+	const u64 now = Common::Timer::GetCurrentValue();
+
+	// Every tile is drawn by a single rasterizer, so each one owns all the scanlines.
+	for (int i = 0; i < threads; i++)
+	{
+		rl->m_r.push_back(std::unique_ptr<GSRasterizer>(new GSRasterizer(&rl->m_ds, 0, 1)));
+		rl->m_workers.push_back(std::make_unique<Worker>());
+		rl->m_workers[i]->counters.Reset(now);
+	}
+
+	// Only start the threads once m_workers is complete, ClaimTiles() and Notify() walk it.
+	for (int i = 0; i < threads; i++)
+		rl->m_workers[i]->thread = std::thread(&GSWorkStealingRasterizerList::WorkerThread, rl.get(), i);
+
+	Console.WriteLn("(GSRasterizer) Work stealing across %d threads, %d tiles of %d lines", threads,
+		rl->m_tile_count, 1 << rl->m_thread_height);
+
+	return rl;
+}
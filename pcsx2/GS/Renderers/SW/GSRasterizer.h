@@ -19,6 +19,7 @@
 #include "common/General.h"
 #include "common/Threading.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -201,9 +202,28 @@ public:
 	__forceinline int FindMyNextScanline(int top) const;
 
 	void Draw(GSRasterizerData& data);
+	void Draw(GSRasterizerData& data, const GSVector4i& clip);
 	int GetPixels(bool reset);
 };
 
+struct GSRasterizerWorkerStats
+{
+	double busy_ms; // time spent rasterizing
+	double idle_ms; // time spent waiting for work
+	u64 jobs;       // draws (banded) or tiles (work stealing) processed
+};
+
+struct GSRasterizerWorkerCounters
+{
+	std::atomic<u64> busy{0};
+	std::atomic<u64> jobs{0};
+	std::atomic<u64> start{0};
+
+	void Reset(u64 now);
+	void Add(u64 begin, u64 end);
+	GSRasterizerWorkerStats Get(u64 now, bool reset);
+};
+
 class IRasterizer : public GSVirtualAlignedClass<32>
 {
 public:
@@ -213,6 +233,9 @@ public:
 	virtual void Sync() = 0;
 	virtual bool IsSynced() const = 0;
 	virtual int GetPixels(bool reset = true) = 0;
+
+	/// Busy/idle time of each worker thread since the last reset, empty when rasterizing on the GS thread.
+	virtual void GetWorkerStats(std::vector<GSRasterizerWorkerStats>& stats, bool reset = true) { stats.clear(); }
 };
 
 class GSSingleRasterizer final : public IRasterizer
@@ -243,16 +266,78 @@ protected:
 	// Worker threads depend on the rasterizers, so don't change the order.
 	std::vector<std::unique_ptr<GSRasterizer>> m_r;
 	std::vector<std::unique_ptr<GSWorker>> m_workers;
+	std::unique_ptr<GSRasterizerWorkerCounters[]> m_counters;
 	u8* m_scanline;
 	int m_thread_height;
 
 	GSRasterizerList(int threads);
 
+public:
+	~GSRasterizerList() override;
+
+	static std::unique_ptr<IRasterizer> Create(int threads);
+
 	static void OnWorkerStartup(int i);
 	static void OnWorkerShutdown(int i);
 
+	// IRasterizer
+
+	void Queue(const GSRingHeap::SharedPtr<GSRasterizerData>& data) override;
+	void Sync() override;
+	bool IsSynced() const override;
+	int GetPixels(bool reset) override;
+	void GetWorkerStats(std::vector<GSRasterizerWorkerStats>& stats, bool reset) override;
+};
+
+/// Splits the screen into bands of scanlines ("tiles") with their own draw queue, instead of
+/// tying each band to a worker. A tile with queued draws is published in a ready bitmap, and
+/// whichever worker is free claims it and drains its queue in order, so a worker stuck with
+/// the busy part of the screen no longer holds up the others. A tile is owned by at most one
+/// worker at a time, which keeps the draws touching it in submission order. A worker claims a
+/// run of adjacent ready tiles at once, so a draw spanning them is set up once, not per tile.
+class GSWorkStealingRasterizerList final : public IRasterizer
+{
+protected:
+	static constexpr int TILE_QUEUE_SIZE = 4096;
+	static constexpr int MAX_BATCH_TILES = 8;
+
+	struct Tile
+	{
+		ringbuffer_base<GSRingHeap::SharedPtr<GSRasterizerData>, TILE_QUEUE_SIZE> queue;
+		std::atomic<bool> scheduled{false}; // queued in m_ready or owned by a worker
+		GSVector4i rect;
+	};
+
+	struct Worker
+	{
+		std::thread thread;
+		Threading::WorkSema sema;
+		GSRasterizerWorkerCounters counters;
+	};
+
+	GSDrawScanline m_ds;
+
+	// Worker threads depend on the rasterizers, so don't change the order.
+	std::vector<std::unique_ptr<GSRasterizer>> m_r;
+	std::vector<std::unique_ptr<Worker>> m_workers;
+	std::unique_ptr<Tile[]> m_tiles;
+	std::unique_ptr<std::atomic<u32>[]> m_ready;
+	std::atomic<int> m_queued{0};
+	int m_tile_count;
+	int m_ready_words;
+	int m_thread_height;
+	std::atomic<u32> m_next_worker{0};
+	std::atomic<bool> m_exit{false};
+
+	GSWorkStealingRasterizerList(int threads);
+
+	void WorkerThread(int i);
+	int ClaimTiles(int i, int* count);
+	void DrainTiles(int i, int first, int count);
+	void Notify();
+
 public:
-	~GSRasterizerList() override;
+	~GSWorkStealingRasterizerList() override;
 
 	static std::unique_ptr<IRasterizer> Create(int threads);
 
@@ -262,6 +347,7 @@ public:
 	void Sync() override;
 	bool IsSynced() const override;
 	int GetPixels(bool reset) override;
+	void GetWorkerStats(std::vector<GSRasterizerWorkerStats>& stats, bool reset) override;
 };
 
 MULTI_ISA_UNSHARED_END
@@ -60,35 +60,49 @@ GSTextureCacheSW::Texture* GSTextureCacheSW::Lookup(const GIFRegTEX0& TEX0, cons
 
 	m_textures.insert(t);
 
+	t->m_erase_it = m.InsertFront(t);
+	t->m_cache = this;
+	t->m_validated = m_generation;
 	t->m_pages.loopPages([this, t](u32 page)
 	{
-		t->m_erase_it[page] = m_map[page].InsertFront(t);
+		t->m_page_gen[page] = GetPageGeneration(page, t->m_channels);
 	});
 
 	return t;
 }
 
-void GSTextureCacheSW::InvalidatePages(const GSOffset::PageLooper& pages, u32 psm)
+u32 GSTextureCacheSW::GetChannels(u32 psm)
 {
-	pages.loopPages([this, psm](u32 page)
+	// Matches GSUtil::HasSharedBits.
+	switch (psm)
 	{
-		for (Texture* t : m_map[page])
-		{
-			if (GSUtil::HasSharedBits(psm, t->m_sharedbits))
-			{
-				u32* RESTRICT valid = t->m_valid;
+		case PSMCT24:
+		case PSMZ24:
+			return CHANNEL_RGB;
+		case PSMT8H:
+			return CHANNEL_HL | CHANNEL_HH;
+		case PSMT4HL:
+			return CHANNEL_HL;
+		case PSMT4HH:
+			return CHANNEL_HH;
+		default:
+			return CHANNEL_ALL;
+	}
+}
 
-				if (t->m_repeating)
-				{
-					for (const GSVector2i& j : t->m_p2t[page])
-						valid[j.x] &= j.y;
-				}
-				else
-					valid[page] = 0;
+void GSTextureCacheSW::InvalidatePages(const GSOffset::PageLooper& pages, u32 psm)
+{
+	const u32 channels = GetChannels(psm);
 
-				t->m_complete = false;
-			}
+	pages.loopPages([this, channels](u32 page)
+	{
+		for (u32 i = 0; i < 3; i++)
+		{
+			if (channels & (1u << i))
+				m_page_gen[i][page]++;
 		}
+
+		m_log[m_generation++ % INVALIDATION_LOG_SIZE] = page | (channels << 16);
 	});
 }
 
@@ -115,10 +129,7 @@ void GSTextureCacheSW::IncAge()
 		{
 			i = m_textures.erase(i);
 
-			t->m_pages.loopPages([this, t](u32 page)
-			{
-				m_map[page].EraseIndex(t->m_erase_it[page]);
-			});
+			m_map[t->m_TEX0.TBP0 >> 5].EraseIndex(t->m_erase_it);
 
 			delete t;
 		}
@@ -139,16 +150,20 @@ GSTextureCacheSW::Texture::Texture(u32 tw0, const GIFRegTEX0& TEX0, const GIFReg
 	, m_age(0)
 	, m_complete(false)
 	, m_p2t(nullptr)
+	, m_validated(0)
+	, m_erase_it(0)
+	, m_cache(nullptr)
 {
 	if (m_tw == 0)
 		m_tw = std::max<int>(m_TEX0.TW, GSLocalMemory::m_psm[m_TEX0.PSM].pal == 0 ? 3 : 5); // makes one row 32 bytes at least, matches the smallest block size that is allocated for m_buff
 
 	memset(m_valid, 0, sizeof(m_valid));
+	memset(m_page_gen, 0, sizeof(m_page_gen));
 
-	m_sharedbits = GSUtil::HasSharedBitsPtr(m_TEX0.PSM);
+	m_channels = GetChannels(m_TEX0.PSM);
 
 	m_offset = g_gs_renderer->m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM);
-	m_pages = m_offset.pageLooperForRect(GSVector4i(0, 0, 1 << TEX0.TW, 1 << TEX0.TH));
+	InitPages();
 
 	m_repeating = m_TEX0.IsRepeating(); // repeating mode always works, it is just slightly slower
 
@@ -181,11 +196,12 @@ void GSTextureCacheSW::Texture::Reset(u32 tw0, const GIFRegTEX0& TEX0, const GIF
 		m_tw = std::max<int>(m_TEX0.TW, GSLocalMemory::m_psm[m_TEX0.PSM].pal == 0 ? 3 : 5); // makes one row 32 bytes at least, matches the smallest block size that is allocated for m_buff
 
 	memset(m_valid, 0, sizeof(m_valid));
+	memset(m_page_gen, 0, sizeof(m_page_gen));
 
-	m_sharedbits = GSUtil::HasSharedBitsPtr(m_TEX0.PSM);
+	m_channels = GetChannels(m_TEX0.PSM);
 
 	m_offset = g_gs_renderer->m_mem.GetOffset(TEX0.TBP0, TEX0.TBW, TEX0.PSM);
-	m_pages = m_offset.pageLooperForRect(GSVector4i(0, 0, 1 << TEX0.TW, 1 << TEX0.TH));
+	InitPages();
 
 	m_repeating = m_TEX0.IsRepeating(); // repeating mode always works, it is just slightly slower
 
@@ -193,8 +209,64 @@ void GSTextureCacheSW::Texture::Reset(u32 tw0, const GIFRegTEX0& TEX0, const GIF
 		m_p2t = g_gs_renderer->m_mem.GetPage2TileMap(m_TEX0);
 }
 
+void GSTextureCacheSW::Texture::InitPages()
+{
+	m_pages = m_offset.pageLooperForRect(GSVector4i(0, 0, 1 << m_TEX0.TW, 1 << m_TEX0.TH));
+
+	memset(m_page_mask, 0, sizeof(m_page_mask));
+	m_pages.loopPages([this](u32 page)
+	{
+		m_page_mask[page >> 5] |= 1u << (page & 31);
+	});
+}
+
+void GSTextureCacheSW::Texture::ValidatePage(u32 page)
+{
+	const u32 gen = m_cache->GetPageGeneration(page, m_channels);
+	if (m_page_gen[page] == gen)
+		return;
+
+	m_page_gen[page] = gen;
+
+	if (m_repeating)
+	{
+		for (const GSVector2i& j : m_p2t[page])
+			m_valid[j.x] &= j.y;
+	}
+	else
+		m_valid[page] = 0;
+
+	m_complete = false;
+}
+
+void GSTextureCacheSW::Texture::Validate()
+{
+	if (!m_cache || m_validated == m_cache->m_generation)
+		return;
+
+	if (m_cache->m_generation - m_validated > INVALIDATION_LOG_SIZE)
+	{
+		m_pages.loopPages([this](u32 page) { ValidatePage(page); });
+	}
+	else
+	{
+		for (u32 i = m_validated; i != m_cache->m_generation; i++)
+		{
+			const u32 entry = m_cache->m_log[i % INVALIDATION_LOG_SIZE];
+			const u32 page = entry & 0xffff;
+
+			if (((entry >> 16) & m_channels) && (m_page_mask[page >> 5] & (1u << (page & 31))))
+				ValidatePage(page);
+		}
+	}
+
+	m_validated = m_cache->m_generation;
+}
+
 bool GSTextureCacheSW::Texture::Update(const GSVector4i& rect)
 {
+	Validate();
+
 	if (m_complete)
 		return true;
 
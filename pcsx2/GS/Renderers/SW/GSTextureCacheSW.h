@@ -37,24 +37,67 @@ public:
 		bool m_repeating;
 		std::vector<GSVector2i>* m_p2t;
 		u32 m_valid[MAX_PAGES];
-		u16 m_erase_it[MAX_PAGES];
-		const u32* RESTRICT m_sharedbits;
+		u32 m_page_gen[MAX_PAGES];
+		u32 m_page_mask[MAX_PAGES / 32];
+		u32 m_validated;
+		u32 m_channels;
+		u16 m_erase_it;
+		const GSTextureCacheSW* m_cache;
 
 		// m_valid
 		// fast mode: each u32 bits map to the 32 blocks of that page
 		// repeating mode: 1 bpp image of the texture tiles (8x8), also having 512 elements is just a coincidence (worst case: (1024*1024)/(8*8)/(sizeof(u32)*8))
 
+		// m_page_gen
+		// the generation of each page the last time it was checked, textures outside a cache (m_cache null) are never invalidated
+
+		// m_page_mask
+		// 1 bit per page the texture covers, to pick its pages out of the invalidation log
+
 		Texture(u32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 		virtual ~Texture();
 
 		void Reset(u32 tw0, const GIFRegTEX0& TEX0, const GIFRegTEXA& TEXA);
 
 		bool Update(const GSVector4i& r);
+
+	private:
+		void InitPages();
+		void ValidatePage(u32 page);
+		void Validate();
 	};
 
 protected:
+	// Channels of a 32 bit pixel, so writes only invalidate textures reading the same bits.
+	enum : u32
+	{
+		CHANNEL_RGB = 1 << 0, // bits 0-23
+		CHANNEL_HL = 1 << 1, // bits 24-27
+		CHANNEL_HH = 1 << 2, // bits 28-31
+		CHANNEL_ALL = CHANNEL_RGB | CHANNEL_HL | CHANNEL_HH,
+	};
+
+	static u32 GetChannels(u32 psm);
+
+	__fi u32 GetPageGeneration(u32 page, u32 channels) const
+	{
+		return ((channels & CHANNEL_RGB) ? m_page_gen[0][page] : 0) +
+			   ((channels & CHANNEL_HL) ? m_page_gen[1][page] : 0) +
+			   ((channels & CHANNEL_HH) ? m_page_gen[2][page] : 0);
+	}
+
 	std::unordered_set<Texture*> m_textures;
-	std::array<FastList<Texture*>, MAX_PAGES> m_map;
+	std::array<FastList<Texture*>, MAX_PAGES> m_map; // by base page, for lookups
+
+	// Invalidation bumps the written pages' generations and logs the pages, and textures go
+	// through the log entries written since their last check when they are next used, so that
+	// costs as much as the writes, not the size of the texture. Textures which fell further
+	// behind than the log reaches compare all of their pages' generations instead.
+	static constexpr u32 INVALIDATION_LOG_SIZE = 4096;
+
+	u32 m_page_gen[3][MAX_PAGES] = {};
+	u32 m_log[INVALIDATION_LOG_SIZE] = {}; // page | channels << 16
+	u32 m_generation = 0; // entries ever written to m_log
 
 public:
 	GSTextureCacheSW();
@@ -3230,9 +3230,25 @@ VkPipeline GSDeviceVK::GetTFXPipeline(const PipelineSelector& p)
 
 	VkPipeline pipeline = CreateTFXPipeline(p);
 	m_tfx_pipelines.emplace(p, pipeline);
+	m_pipeline_usage_log.Record(&p);
 	return pipeline;
 }
 
+u32 GSDeviceVK::GetPipelineUsageKeySize() const
+{
+	return sizeof(PipelineSelector);
+}
+
+bool GSDeviceVK::PrewarmPipeline(const void* key)
+{
+	PipelineSelector p;
+	std::memcpy(&p, key, sizeof(p));
+	if (p.topology > static_cast<u8>(GSHWDrawConfig::Topology::Triangle))
+		return false;
+
+	return (GetTFXPipeline(p) != VK_NULL_HANDLE);
+}
+
 bool GSDeviceVK::BindDrawPipeline(const PipelineSelector& p)
 {
 	VkPipeline pipeline = GetTFXPipeline(p);
@@ -384,6 +384,9 @@ private:
 	VkPipeline CreateTFXPipeline(const PipelineSelector& p);
 	VkPipeline GetTFXPipeline(const PipelineSelector& p);
 
+	u32 GetPipelineUsageKeySize() const override;
+	bool PrewarmPipeline(const void* key) override;
+
 	VkShaderModule GetUtilityVertexShader(const char *source, const char* replace_main);
 	VkShaderModule GetUtilityFragmentShader(const char *source, const char* replace_main);
 	VkShaderModule GetUtilityVertexShader(const std::string& source, const char* replace_main);
@@ -13,9 +13,13 @@
  *  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <fstream>
+#include <mutex>
 #include <optional>
+#include <sys/stat.h>
 
 #include <fmt/format.h>
 
@@ -42,14 +46,54 @@ namespace GameDatabaseSchema
 namespace GameDatabase
 {
 	static void parseAndInsert(const char *serial, const c4::yml::NodeRef& node);
+	static void setYamlCallbacks();
+	static bool loadIndex();
+	static const GameDatabaseSchema::GameEntry* findInIndex(const std::string& serial);
 	static void initDatabase();
 } // namespace GameDatabase
 
+// Binary form of the database, written by tools/generate_gamedb_index.py.
+// Serials are sorted so they can be binary searched, and each record is the YAML text of a
+// single entry, so only the games which are actually looked up ever get parsed.
+namespace GameDatabaseIndex
+{
+	static constexpr u32 MAGIC = 0x49424447; // 'GDBI'
+	static constexpr u32 VERSION = 1;
+
+	struct Header
+	{
+		u32 magic;
+		u32 version;
+		u32 yaml_size;      // size and crc32 of the GameIndex.yaml it was built from, only the size is checked
+		u32 yaml_crc;
+		u32 entry_count;
+		u32 entries_offset; // Entry[entry_count], sorted by serial
+		u32 strings_offset; // lower-case serials
+		u32 records_offset; // YAML text of each entry
+	};
+
+	struct Entry
+	{
+		u32 serial_offset;
+		u32 serial_length;
+		u32 record_offset;
+		u32 record_length;
+	};
+} // namespace GameDatabaseIndex
+
 static constexpr char GAMEDB_YAML_FILE_NAME[] = "GameIndex.yaml";
+static constexpr char GAMEDB_INDEX_FILE_NAME[] = "GameIndex.bin";
 
 static std::unordered_map<std::string, GameDatabaseSchema::GameEntry> s_game_db;
 static std::once_flag s_load_once_flag;
 
+// Entries are decoded from the index on first lookup, so s_game_db is only complete when the YAML was used.
+// Only the header, entry table and serials are held, records are read from s_index_path as needed.
+static std::vector<u8> s_index_table;
+static std::string s_index_path;
+static std::mutex s_game_db_mutex;
+static size_t s_game_count = 0;
+
 std::string GameDatabaseSchema::GameEntry::memcardFiltersAsString() const
 {
 	return fmt::to_string(fmt::join(memcardFilters, "/"));
@@ -865,7 +909,7 @@ u32 GameDatabaseSchema::GameEntry::applyGSHardwareFixes(Pcsx2Config::GSOptions&
 	return num_applied_fixes;
 }
 
-void GameDatabase::initDatabase()
+void GameDatabase::setYamlCallbacks()
 {
 	ryml::Callbacks rymlCallbacks = ryml::get_callbacks();
 	rymlCallbacks.m_error = [](const char* msg, size_t msg_len, ryml::Location loc, void*) {
@@ -877,14 +921,139 @@ void GameDatabase::initDatabase()
 		Console.Error("[YAML] Internal Parsing error: {%s}",
 			msg);
 	});
-	auto buf = Host::ReadResourceFileToString(GAMEDB_YAML_FILE_NAME);
+}
+
+bool GameDatabase::loadIndex()
+{
+	using namespace GameDatabaseIndex;
+
+	const std::string index_path = Host::GetResourceFilePath(GAMEDB_INDEX_FILE_NAME);
+	struct stat index_st;
+	if (!FileSystem::StatFile(index_path.c_str(), &index_st))
+		return false;
+
+	RFILE* fp = FileSystem::OpenFile(index_path.c_str(), "rb");
+	if (!fp)
+		return false;
+
+	Header header;
+	if (rfread(&header, sizeof(header), 1, fp) != 1)
+	{
+		Console.Error("[GameDB] %s is truncated", GAMEDB_INDEX_FILE_NAME);
+		rfclose(fp);
+		return false;
+	}
+
+	const u64 entries_end = header.entries_offset + static_cast<u64>(header.entry_count) * sizeof(Entry);
+	if (header.magic != MAGIC || header.version != VERSION || header.entries_offset < sizeof(header) ||
+		entries_end > header.strings_offset || header.strings_offset > header.records_offset ||
+		header.records_offset > static_cast<u64>(index_st.st_size))
+	{
+		Console.Error("[GameDB] %s is not a valid index", GAMEDB_INDEX_FILE_NAME);
+		rfclose(fp);
+		return false;
+	}
+
+	// Hashing the YAML would mean reading all of it, which is what the index is there to avoid.
+	// A different size or a newer YAML is enough to tell it was edited after the index was built.
+	// Without the YAML there's nothing to be stale against, so the index is all we have.
+	struct stat yaml_st;
+	if (FileSystem::StatFile(Host::GetResourceFilePath(GAMEDB_YAML_FILE_NAME).c_str(), &yaml_st) &&
+		(static_cast<u64>(yaml_st.st_size) != header.yaml_size || yaml_st.st_mtime > index_st.st_mtime))
+	{
+		Console.Warning("[GameDB] %s is out of date, falling back to %s", GAMEDB_INDEX_FILE_NAME, GAMEDB_YAML_FILE_NAME);
+		rfclose(fp);
+		return false;
+	}
+
+	// Keep the serial table, the records stay on disk until one is looked up.
+	std::vector<u8> table(header.records_offset);
+	std::memcpy(table.data(), &header, sizeof(header));
+	const s64 rest = static_cast<s64>(table.size() - sizeof(header));
+	const bool read_ok = rfread(table.data() + sizeof(header), 1, rest, fp) == rest;
+	rfclose(fp);
+	if (!read_ok)
+	{
+		Console.Error("[GameDB] %s is truncated", GAMEDB_INDEX_FILE_NAME);
+		return false;
+	}
+
+	const Entry* entries = reinterpret_cast<const Entry*>(table.data() + header.entries_offset);
+	const u64 strings_size = header.records_offset - header.strings_offset;
+	const u64 records_size = static_cast<u64>(index_st.st_size) - header.records_offset;
+	for (u32 i = 0; i < header.entry_count; i++)
+	{
+		if (entries[i].serial_offset + static_cast<u64>(entries[i].serial_length) > strings_size ||
+			entries[i].record_offset + static_cast<u64>(entries[i].record_length) > records_size)
+		{
+			Console.Error("[GameDB] %s has an entry out of bounds", GAMEDB_INDEX_FILE_NAME);
+			return false;
+		}
+	}
+
+	s_index_table = std::move(table);
+	s_index_path = std::move(index_path);
+	s_game_count = header.entry_count;
+	return true;
+}
+
+const GameDatabaseSchema::GameEntry* GameDatabase::findInIndex(const std::string& serial)
+{
+	using namespace GameDatabaseIndex;
+
+	Header header;
+	std::memcpy(&header, s_index_table.data(), sizeof(header));
+	const Entry* begin = reinterpret_cast<const Entry*>(s_index_table.data() + header.entries_offset);
+	const Entry* end = begin + header.entry_count;
+	const char* strings = reinterpret_cast<const char*>(s_index_table.data() + header.strings_offset);
+
+	auto entry_serial = [strings](const Entry& entry) {
+		return std::string_view(strings + entry.serial_offset, entry.serial_length);
+	};
+	const Entry* it = std::lower_bound(begin, end, std::string_view(serial), [&entry_serial](const Entry& entry, const std::string_view& value) {
+		return entry_serial(entry) < value;
+	});
+	if (it == end || entry_serial(*it) != serial)
+		return nullptr;
+
+	std::string record(it->record_length, '\0');
+	RFILE* fp = FileSystem::OpenFile(s_index_path.c_str(), "rb");
+	const bool read_ok = fp && FileSystem::FSeek64(fp, header.records_offset + static_cast<s64>(it->record_offset), SEEK_SET) == 0 &&
+						 rfread(record.data(), 1, record.size(), fp) == static_cast<s64>(record.size());
+	if (fp)
+		rfclose(fp);
+	if (!read_ok)
+	{
+		Console.Error("[GameDB] Failed to read the entry for '%s' from %s", serial.c_str(), GAMEDB_INDEX_FILE_NAME);
+		return nullptr;
+	}
+
+	setYamlCallbacks();
+	ryml::Tree tree = ryml::parse_in_arena(c4::csubstr(record.data(), record.size()));
+	ryml::NodeRef root = tree.rootref();
+	if (root.num_children() == 1 && root.first_child().is_map())
+		parseAndInsert(serial.c_str(), root.first_child());
+	ryml::reset_callbacks();
+
+	auto iter = s_game_db.find(serial);
+	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+}
+
+void GameDatabase::initDatabase()
+{
+	if (loadIndex())
+		return;
+
+	const std::optional<std::vector<u8>> buf = Host::ResourceFileExists(GAMEDB_YAML_FILE_NAME) ?
+		Host::ReadResourceFile(GAMEDB_YAML_FILE_NAME) : std::nullopt;
 	if (!buf.has_value())
 	{
 		Console.Error("[GameDB] Unable to open GameDB file, file does not exist.");
 		return;
 	}
 
-	ryml::Tree tree = ryml::parse_in_arena(c4::to_csubstr(buf.value()));
+	setYamlCallbacks();
+	ryml::Tree tree = ryml::parse_in_arena(c4::csubstr(reinterpret_cast<const char*>(buf->data()), buf->size()));
 	ryml::NodeRef root = tree.rootref();
 
 	for (const auto& n : root.children())
@@ -905,6 +1074,7 @@ void GameDatabase::initDatabase()
 	}
 
 	ryml::reset_callbacks();
+	s_game_count = s_game_db.size();
 }
 
 void GameDatabase::ensureLoaded()
@@ -912,7 +1082,7 @@ void GameDatabase::ensureLoaded()
 	std::call_once(s_load_once_flag, []() {
 		Console.WriteLn("[GameDB] Has not been initialized yet, initializing...");
 		initDatabase();
-		Console.WriteLn("[GameDB] %zu games on record", s_game_db.size());
+		Console.WriteLn("[GameDB] %zu games on record%s", s_game_count, s_index_table.empty() ? "" : " (binary index)");
 	});
 }
 
@@ -920,6 +1090,11 @@ const GameDatabaseSchema::GameEntry* GameDatabase::findGame(const std::string_vi
 {
 	GameDatabase::ensureLoaded();
 
-	auto iter = s_game_db.find(StringUtil::toLower(serial));
-	return (iter != s_game_db.end()) ? &iter->second : nullptr;
+	const std::string key = StringUtil::toLower(serial);
+	std::unique_lock lock(s_game_db_mutex);
+	auto iter = s_game_db.find(key);
+	if (iter != s_game_db.end())
+		return &iter->second;
+
+	return s_index_table.empty() ? nullptr : findInIndex(key);
 }
@@ -284,7 +284,7 @@ struct Gif_Path
 			s32 frontFree = offset - getReadAmount();
 			if (frontFree >= sizeToAdd - intersect)
 				break;
-			MTGS::WaitGS(isMTVU());
+			MTGS::WaitGS(isMTVU(), MTGS_WaitReason::GifBuffer);
 		}
 		if (offset < (s32)buffLimit)
 		{ // Needed for correct readAmount values
@@ -316,7 +316,7 @@ struct Gif_Path
 				break; // MTGS is reading in back of curOffset
 			if ((s32)buffLimit + readPos > (s32)curSize + (s32)size)
 				break;      // Enough free front space
-			MTGS::WaitGS(isMTVU()); // Let MTGS run to free up buffer space
+			MTGS::WaitGS(isMTVU(), MTGS_WaitReason::GifBuffer); // Let MTGS run to free up buffer space
 		}
 		memcpy(&buffer[curSize], pMem, size);
 		curSize += size;
@@ -58,4 +58,10 @@ namespace Host
 
 	/// Reads a resource file file from the resources directory as a string.
 	std::optional<std::string> ReadResourceFileToString(const char* filename);
+
+	/// Returns true if the resources directory contains the file, for optional resources.
+	bool ResourceFileExists(const char* filename);
+
+	/// Returns the path of a file in the resources directory, for callers which only read part of it.
+	std::string GetResourceFilePath(const char* filename);
 } // namespace Host
@@ -20,6 +20,7 @@
 
 #include "IPU.h"
 #include "IPU_MultiISA.h"
+#include "IPU_Thread.h"
 #include "IPUdma.h"
 
 #include "../Config.h"
@@ -31,6 +32,7 @@ alignas(16) decoder_t decoder;
 IPUStatus IPUCoreStatus;
 
 static void (*IPUWorker)(void);
+static void (*IPUThreadSync)(void);
 
 // Color conversion stuff, the memory layout is a total hack
 // convert_data_buffer is a pointer to the internal rgb struct (the first param in convert_init_t)
@@ -100,7 +102,11 @@ __fi void IPUProcessInterrupt(void)
 
 void ipuReset(void)
 {
+	if (IPUThreadSync)
+		IPUThreadSync();
+
 	IPUWorker = MULTI_ISA_SELECT(IPUWorker);
+	IPUThreadSync = MULTI_ISA_SELECT(IPUThreadSync);
 	memset(&ipuRegs, 0, sizeof(ipuRegs));
 	memset(&g_BP, 0, sizeof(g_BP));
 	memset(&decoder, 0, sizeof(decoder));
@@ -121,6 +127,11 @@ bool SaveStateBase::ipuFreeze(void)
 	if (!(FreezeTag("IPU")))
 		return false;
 
+	// A macroblock still on the IPU thread has to land in decoder before it's saved,
+	// and mustn't land on top of a state being loaded.
+	if (IPUThreadSync)
+		IPUThreadSync();
+
 	Freeze(ipu_fifo);
 
 	Freeze(g_BP);
@@ -201,6 +212,9 @@ __fi u64 ipuRead64(u32 mem)
 
 void ipuSoftReset(void)
 {
+	if (IPUThreadSync)
+		IPUThreadSync();
+
 	ipu_fifo.clear();
 	memset(&g_BP, 0, sizeof(g_BP));
 
@@ -325,6 +339,9 @@ static void ipuSETTH(u32 val)
 // The actual decoding will be handled by IPUworker.
 __fi void IPUCMD_WRITE(u32 val)
 {
+	if (IPUThreadSync)
+		IPUThreadSync();
+
 	ipuRegs.ctrl.ECD = 0;
 	ipuRegs.ctrl.SCD = 0;
 	ipu_cmd.clear();
@@ -349,6 +366,7 @@ __fi void IPUCMD_WRITE(u32 val)
 		case SCE_IPU_IDEC:
 			{
 				tIPU_CMD_IDEC _val;
+				ipuThread.ApplySettings();
 				g_BP.Advance(val & 0x3F);
 				_val._u32       = val;
 				ipuIDEC(_val);
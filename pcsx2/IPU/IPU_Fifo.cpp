@@ -22,6 +22,10 @@
 
 alignas(16) IPU_Fifo ipu_fifo;
 
+bool IPU_Fifo_Input::peeking = false;
+bool IPU_Fifo_Input::peek_starved = false;
+u32 IPU_Fifo_Input::peeked = 0;
+
 void IPU_Fifo::init()
 {
 	out.readpos = 0;
@@ -89,6 +93,19 @@ int IPU_Fifo_Input::write(const u32* pMem, int size)
 
 int IPU_Fifo_Input::read(void *value)
 {
+	if (peeking)
+	{
+		if (peeked >= g_BP.IFC)
+		{
+			peek_starved = true;
+			return 0;
+		}
+
+		CopyQWC(value, &data[(readpos + peeked * 4) & 31]);
+		peeked++;
+		return 1;
+	}
+
 	// wait until enough data to ensure proper streaming.
 	if (g_BP.IFC <= 1)
 	{
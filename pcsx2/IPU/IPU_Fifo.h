@@ -28,6 +28,13 @@ struct IPU_Fifo_Input
 	alignas(16) u32 data[32];
 	int readpos, writepos;
 
+	// While peeking, read() hands out the quadwords after the ones already peeked at and
+	// leaves the FIFO alone, so IDEC can parse ahead. peek_starved is set once it runs dry.
+	// These aren't part of the FIFO's state, so they're static and stay out of savestates.
+	static bool peeking;
+	static bool peek_starved;
+	static u32 peeked;
+
 	int write(const u32* pMem, int size);
 	int read(void *value);
 	void clear();
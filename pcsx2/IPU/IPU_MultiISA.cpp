@@ -30,6 +30,7 @@
 #include "IPUdma.h"
 #include "yuv2rgb.h"
 #include "IPU_MultiISA.h"
+#include "IPU_Thread.h"
 
 // the IPU is fixed to 16 byte strides (128-bit / QWC resolution):
 static const uint decoder_stride = 16;
@@ -81,7 +82,7 @@ alignas(16) const mpeg2_scan_pack mpeg2_scan = make_scan_pack();
 
 MULTI_ISA_UNSHARED_START
 
-static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn);
+static void ipu_csc(const macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn, const u16* thresh);
 static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4);
 
 // --------------------------------------------------------------------------------------
@@ -839,7 +840,9 @@ __ri static bool get_non_intra_block(int * last)
 	return true;
 }
 
-__ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride, const bool skip)
+// With a job, the coefficients are stashed in it for the IPU thread instead of being transformed here.
+__ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride, const bool skip,
+	IPUMacroblockJob* job = nullptr, const int block = 0)
 {
 	if (!skip || ipu_cmd.pos[3])
 	{
@@ -862,11 +865,72 @@ __ri static bool slice_intra_DCT(const int cc, u8 * const dest, const int stride
 	if (!get_intra_block())
 		return false;
 
+	if (job)
+	{
+		std::memcpy(job->blocks[block], decoder.DCTblock, sizeof(decoder.DCTblock));
+		std::memset(decoder.DCTblock, 0, sizeof(decoder.DCTblock));
+		job->blocks_mask |= 1 << block;
+		return true;
+	}
+
 	IDCT_Copy(decoder.DCTblock, dest, stride);
 
 	return true;
 }
 
+// Transforms the blocks stashed by slice_intra_DCT() into mb8, using the IDEC block layout.
+__ri static void IDCT_CopyJobBlocks(IPUMacroblockJob& job, macroblock_8& mb8)
+{
+	const int DCT_offset = job.interlaced ? decoder_stride : decoder_stride * 8;
+	const int DCT_stride = job.interlaced ? decoder_stride * 2 : decoder_stride;
+	u8* const dest[6] = {(u8*)mb8.Y, (u8*)mb8.Y + 8, (u8*)mb8.Y + DCT_offset, (u8*)mb8.Y + DCT_offset + 8, (u8*)mb8.Cb, (u8*)mb8.Cr};
+
+	for (int i = 0; i < 6; i++)
+	{
+		if (job.blocks_mask & (1 << i))
+			IDCT_Copy(job.blocks[i], dest[i], (i < 4) ? DCT_stride : (decoder_stride >> 1));
+	}
+
+	job.blocks_mask = 0;
+}
+
+// Runs on the IPU thread.
+static void IDECMacroblockJob(IPUMacroblockJob& job)
+{
+	IDCT_CopyJobBlocks(job, job.mb8);
+	ipu_csc(job.mb8, job.rgb32, job.sgn, job.thresh);
+	if (job.ofm)
+		ipu_dither(job.rgb32, job.rgb16, job.dte);
+}
+
+__ri static void IDECCollect(void)
+{
+	IPUMacroblockJob& job = ipuThread.Collect();
+
+	std::memcpy(&decoder.mb8, &job.mb8, sizeof(decoder.mb8));
+	std::memcpy(&decoder.rgb32, &job.rgb32, sizeof(decoder.rgb32));
+	if (job.ofm)
+	{
+		std::memcpy(&decoder.rgb16, &job.rgb16, sizeof(decoder.rgb16));
+		decoder.SetOutputTo(decoder.rgb16);
+	}
+	else
+		decoder.SetOutputTo(decoder.rgb32);
+}
+
+// Hands a parsed macroblock to the IPU thread.
+__ri static void IDECSubmit(IPUMacroblockJob& job)
+{
+	std::memcpy(&job.mb8, &decoder.mb8, sizeof(job.mb8));
+	job.thresh[0] = g_ipu_thresh[0];
+	job.thresh[1] = g_ipu_thresh[1];
+	job.sgn = decoder.sgn != 0;
+	job.ofm = decoder.ofm != 0;
+	job.dte = decoder.dte != 0;
+	job.func = IDECMacroblockJob;
+	ipuThread.Submit();
+}
+
 __ri static bool slice_non_intra_DCT(s16 * const dest, const int stride, const bool skip)
 {
 	int last = 0;
@@ -886,10 +950,345 @@ __ri static bool slice_non_intra_DCT(s16 * const dest, const int stride, const b
 	ipuRegs.ctrl.SCD = 0; \
 	coded_block_pattern = decoder.coded_block_pattern
 
-__ri static bool mpeg2sliceIDEC(void)
+// Reads the macroblock address increment, IDEC steps 3 and 4.
+// Returns 1 once it's read, 0 if it needs more data and -1 at the end of the slice.
+__ri static int IDECParseAddress(void)
 {
 	u16 code;
+	const MBAtab * mba;
+
+	switch (ipu_cmd.pos[1])
+	{
+		case 3:
+			for (;;)
+			{
+				if (!GETWORD())
+				{
+					ipu_cmd.pos[1] = 3;
+					return 0;
+				}
+
+				code = UBITS(16);
+				if (code >= 0x1000)
+				{
+					mba = MBA.mba5 + (UBITS(5) - 2);
+					break;
+				}
+				else if (code >= 0x0300)
+				{
+					mba = MBA.mba11 + (UBITS(11) - 24);
+					break;
+				}
+				else switch (UBITS(11))
+				{
+					case 8:		/* macroblock_escape */
+						mbaCount += 33;
+						/* fall-through */
+
+					case 15:	/* macroblock_stuffing (MPEG1 only) */
+						DUMPBITS(11);
+						continue;
+
+					default:	/* end of slice/frame, or error? */
+						return -1;
+				}
+			}
+
+			DUMPBITS(mba->len);
+			mbaCount += mba->mba;
+
+			if (mbaCount)
+				decoder.dc_dct_pred[0] =
+				decoder.dc_dct_pred[1] =
+				decoder.dc_dct_pred[2] = 128 << decoder.intra_dc_precision;
+			/* fall-through */
+
+		case 4:
+			if (!GETWORD())
+			{
+				ipu_cmd.pos[1] = 4;
+				return 0;
+			}
+			break;
+		default:
+			break;
+	}
+
+	return 1;
+}
+
+// Reads the macroblock modes and the six blocks, IDEC steps 0 and 1. With a job, the blocks are
+// left in it for the IPU thread, otherwise they're transformed into mb8.
+__ri static bool IDECParseBlocks(IPUMacroblockJob* job)
+{
+	macroblock_8& mb8 = decoder.mb8;
+	macroblock_rgb32& rgb32 = decoder.rgb32;
+	int DCT_offset, DCT_stride;
+
+	switch (ipu_cmd.pos[1])
+	{
+		case 0:
+			decoder.macroblock_modes = GetMacroblockModes();
+
+			if (decoder.macroblock_modes & MACROBLOCK_QUANT) //only IDEC
+			{
+				const int quantizer_scale_code = GETBITS(5);
+				if (decoder.q_scale_type)
+					decoder.quantizer_scale = non_linear_quantizer_scale[quantizer_scale_code];
+				else
+					decoder.quantizer_scale = quantizer_scale_code << 1;
+			}
+
+			decoder.coded_block_pattern = 0x3F;//all 6 blocks
+			memset(&mb8, 0, sizeof(mb8));
+			memset(&rgb32, 0, sizeof(rgb32));
+			if (job)
+				job->blocks_mask = 0;
+			/* fall-through */
+
+		case 1:
+			ipu_cmd.pos[1] = 1;
+
+			if (decoder.macroblock_modes & DCT_TYPE_INTERLACED)
+			{
+				DCT_offset = decoder_stride;
+				DCT_stride = decoder_stride * 2;
+			}
+			else
+			{
+				DCT_offset = decoder_stride * 8;
+				DCT_stride = decoder_stride;
+			}
+
+			if (job)
+				job->interlaced = (decoder.macroblock_modes & DCT_TYPE_INTERLACED) != 0;
+
+			switch (ipu_cmd.pos[2])
+			{
+				case 0:
+				case 1:
+					if (!slice_intra_DCT(0, (u8*)mb8.Y, DCT_stride, ipu_cmd.pos[2] == 1, job, 0))
+					{
+						ipu_cmd.pos[2] = 1;
+						return false;
+					}
+					/* fall-through */
+
+				case 2:
+					if (!slice_intra_DCT(0, (u8*)mb8.Y + 8, DCT_stride, ipu_cmd.pos[2] == 2, job, 1))
+					{
+						ipu_cmd.pos[2] = 2;
+						return false;
+					}
+					/* fall-through */
+
+				case 3:
+					if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset, DCT_stride, ipu_cmd.pos[2] == 3, job, 2))
+					{
+						ipu_cmd.pos[2] = 3;
+						return false;
+					}
+					/* fall-through */
+
+				case 4:
+					if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset + 8, DCT_stride, ipu_cmd.pos[2] == 4, job, 3))
+					{
+						ipu_cmd.pos[2] = 4;
+						return false;
+					}
+					/* fall-through */
+
+				case 5:
+					if (!slice_intra_DCT(1, (u8*)mb8.Cb, decoder_stride >> 1, ipu_cmd.pos[2] == 5, job, 4))
+					{
+						ipu_cmd.pos[2] = 5;
+						return false;
+					}
+					/* fall-through */
+
+				case 6:
+					if (!slice_intra_DCT(2, (u8*)mb8.Cr, decoder_stride >> 1, ipu_cmd.pos[2] == 6, job, 5))
+					{
+						ipu_cmd.pos[2] = 6;
+						return false;
+					}
+					break;
+				default:
+					break;
+			}
+			break;
+		default:
+			break;
+	}
+
+	return true;
+}
+
+// Bitstream and decoder state around a macroblock parsed ahead.
+struct IDECParseState
+{
+	tIPU_BP bp;           // IFC isn't used, the FIFO reads are replayed instead
+	int readpos;          // input FIFO read position
+	int mba_count;
+	int macroblock_modes;
+	int quantizer_scale;
+	s16 dc_dct_pred[3];
+};
+
+enum IDECAheadPart : u32
+{
+	IDEC_AHEAD_ADDRESS, // the address increment is next
+	IDEC_AHEAD_BLOCKS,  // the modes and blocks are next
+	IDEC_AHEAD_NONE,
+};
+
+// The macroblock parsed ahead by IDECParseAhead(). Part i starts from states[i] and leaves
+// states[i + 1] behind, after taking reads[i] quadwords from the input FIFO.
+static struct
+{
+	IDECAheadPart next = IDEC_AHEAD_NONE;
+	u32 reads[2];
+	IDECParseState states[3];
+} s_idec_ahead;
+
+static void IDECSaveParseState(IDECParseState& state)
+{
+	std::memcpy(&state.bp, &g_BP, sizeof(state.bp));
+	state.readpos = (ipu_fifo.in.readpos + IPU_Fifo_Input::peeked * 4) & 31;
+	state.mba_count = mbaCount;
+	state.macroblock_modes = decoder.macroblock_modes;
+	state.quantizer_scale = decoder.quantizer_scale;
+	std::memcpy(state.dc_dct_pred, decoder.dc_dct_pred, sizeof(state.dc_dct_pred));
+}
+
+static bool IDECMatchesParseState(const IDECParseState& state)
+{
+	return g_BP.BP == state.bp.BP && g_BP.FP == state.bp.FP &&
+		   std::memcmp(g_BP.internal_qwc, state.bp.internal_qwc, sizeof(g_BP.internal_qwc)) == 0 &&
+		   ipu_fifo.in.readpos == state.readpos && mbaCount == state.mba_count &&
+		   decoder.macroblock_modes == state.macroblock_modes && decoder.quantizer_scale == state.quantizer_scale &&
+		   std::memcmp(decoder.dc_dct_pred, state.dc_dct_pred, sizeof(state.dc_dct_pred)) == 0;
+}
+
+static void IDECLoadParseState(const IDECParseState& state, u32 reads)
+{
+	// Take the quadwords off the FIFO for real, so DMA gets asked for more just like parsing would.
+	alignas(16) u128 unused;
+	for (u32 i = 0; i < reads; i++)
+		ipu_fifo.in.read(&unused);
+
+	g_BP.BP = state.bp.BP;
+	g_BP.FP = state.bp.FP;
+	std::memcpy(g_BP.internal_qwc, state.bp.internal_qwc, sizeof(g_BP.internal_qwc));
+	mbaCount = state.mba_count;
+	decoder.macroblock_modes = state.macroblock_modes;
+	decoder.quantizer_scale = state.quantizer_scale;
+	std::memcpy(decoder.dc_dct_pred, state.dc_dct_pred, sizeof(decoder.dc_dct_pred));
+}
+
+// Throws away the macroblock parsed ahead, IDEC parses it again itself.
+static void IDECDropAhead(void)
+{
+	if (s_idec_ahead.next == IDEC_AHEAD_NONE)
+		return;
+
+	// Everything but the job was put back when it was parsed.
+	ipuThread.Retract();
+	s_idec_ahead.next = IDEC_AHEAD_NONE;
+}
 
+// Parses the macroblock after the one just submitted, so the IPU thread can work on it while that
+// one is sent. This only peeks at the input FIFO and puts all the state back afterwards, emulated
+// timing and savestates never see it. IDECApplyAhead() skips over what was parsed once IDEC gets
+// there, as long as it gets there from the same state.
+__ri static void IDECParseAhead(void)
+{
+	if (s_idec_ahead.next != IDEC_AHEAD_NONE || !ipuThread.CanSubmit())
+		return;
+
+	alignas(16) static decoder_t saved_decoder;
+	alignas(16) tIPU_BP saved_bp;
+	alignas(16) tIPU_cmd saved_cmd;
+	std::memcpy(&saved_decoder, &decoder, sizeof(decoder));
+	std::memcpy(&saved_bp, &g_BP, sizeof(g_BP));
+	std::memcpy(&saved_cmd, &ipu_cmd, sizeof(ipu_cmd));
+	const IPUStatus saved_status = IPUCoreStatus;
+	const int saved_mba_count = mbaCount;
+
+	IPU_Fifo_Input::peeking = true;
+	IPU_Fifo_Input::peek_starved = false;
+	IPU_Fifo_Input::peeked = 0;
+
+	// Where IDEC will be once the current macroblock has been sent.
+	mbaCount = 0;
+	ipu_cmd.pos[1] = 3;
+	IDECSaveParseState(s_idec_ahead.states[0]);
+
+	bool parsed = false;
+	if (IDECParseAddress() == 1 && !IPU_Fifo_Input::peek_starved)
+	{
+		s_idec_ahead.reads[0] = IPU_Fifo_Input::peeked;
+		IDECSaveParseState(s_idec_ahead.states[1]);
+
+		ipu_cmd.pos[1] = 0;
+		ipu_cmd.pos[2] = 0;
+		IPUMacroblockJob& job = ipuThread.GetJob();
+		if (IDECParseBlocks(&job) && !IPU_Fifo_Input::peek_starved)
+		{
+			s_idec_ahead.reads[1] = IPU_Fifo_Input::peeked - s_idec_ahead.reads[0];
+			IDECSaveParseState(s_idec_ahead.states[2]);
+			IDECSubmit(job);
+			parsed = true;
+		}
+		else
+		{
+			// Don't leave half a macroblock for IPUThreadSync() to find.
+			job.blocks_mask = 0;
+		}
+	}
+
+	IPU_Fifo_Input::peeking = false;
+	IPU_Fifo_Input::peeked = 0;
+
+	std::memcpy(&decoder, &saved_decoder, sizeof(decoder));
+	std::memcpy(&g_BP, &saved_bp, sizeof(g_BP));
+	std::memcpy(&ipu_cmd, &saved_cmd, sizeof(ipu_cmd));
+	IPUCoreStatus = saved_status;
+	mbaCount = saved_mba_count;
+
+	if (parsed)
+		s_idec_ahead.next = IDEC_AHEAD_ADDRESS;
+}
+
+// Skips over the next part of the macroblock parsed ahead, if IDEC is where that part was parsed from.
+__ri static bool IDECApplyAhead(IDECAheadPart part)
+{
+	if (s_idec_ahead.next == IDEC_AHEAD_NONE)
+		return false;
+
+	if (s_idec_ahead.next != part || (part == IDEC_AHEAD_BLOCKS && ipu_cmd.pos[2]) ||
+		ipu_cmd.pos[3] || ipu_cmd.pos[4] || ipu_cmd.pos[5] ||
+		g_BP.IFC < s_idec_ahead.reads[part] || !IDECMatchesParseState(s_idec_ahead.states[part]))
+	{
+		IDECDropAhead();
+		return false;
+	}
+
+	IDECLoadParseState(s_idec_ahead.states[part + 1], s_idec_ahead.reads[part]);
+	if (part == IDEC_AHEAD_BLOCKS)
+	{
+		// The rest of what IDECParseBlocks() leaves behind, the blocks are with the IPU thread already.
+		decoder.coded_block_pattern = 0x3F;
+		memset(&decoder.mb8, 0, sizeof(decoder.mb8));
+		memset(&decoder.rgb32, 0, sizeof(decoder.rgb32));
+	}
+
+	s_idec_ahead.next = static_cast<IDECAheadPart>(part + 1);
+	return true;
+}
+
+__ri static bool mpeg2sliceIDEC(void)
+{
 	static bool ready_to_decode = true;
 	switch (ipu_cmd.pos[0])
 	{
@@ -918,111 +1317,43 @@ __ri static bool mpeg2sliceIDEC(void)
 					IPUCoreStatus.WaitingOnIPUFrom = true;
 					return false;
 				}
+
+				if (ipu_cmd.pos[1] == 0 && IDECApplyAhead(IDEC_AHEAD_BLOCKS))
+					ipu_cmd.pos[1] = 2;
+
 				macroblock_8& mb8 = decoder.mb8;
 				macroblock_rgb16& rgb16 = decoder.rgb16;
 				macroblock_rgb32& rgb32 = decoder.rgb32;
-
-				int DCT_offset, DCT_stride;
-				const MBAtab * mba;
+				IPUMacroblockJob* job = ipuThread.IsOpen() ? &ipuThread.GetJob() : nullptr;
 
 				switch (ipu_cmd.pos[1])
 				{
 					case 0:
-						decoder.macroblock_modes = GetMacroblockModes();
-
-						if (decoder.macroblock_modes & MACROBLOCK_QUANT) //only IDEC
-						{
-							const int quantizer_scale_code = GETBITS(5);
-							if (decoder.q_scale_type)
-								decoder.quantizer_scale = non_linear_quantizer_scale[quantizer_scale_code];
-							else
-								decoder.quantizer_scale = quantizer_scale_code << 1;
-						}
-
-						decoder.coded_block_pattern = 0x3F;//all 6 blocks
-						memset(&mb8, 0, sizeof(mb8));
-						memset(&rgb32, 0, sizeof(rgb32));
-						/* fall-through */
-
 					case 1:
-						ipu_cmd.pos[1] = 1;
+						if (!IDECParseBlocks(job))
+							return false;
 
-						if (decoder.macroblock_modes & DCT_TYPE_INTERLACED)
+						if (job)
 						{
-							DCT_offset = decoder_stride;
-							DCT_stride = decoder_stride * 2;
+							// The IPU thread finishes the macroblock while the next one is parsed
+							// ahead, it's collected before anything is sent.
+							IDECSubmit(*job);
+							ipu_cmd.pos[1] = 2;
 						}
 						else
 						{
-							DCT_offset = decoder_stride * 8;
-							DCT_stride = decoder_stride;
-						}
+							// Send The MacroBlock via DmaIpuFrom
+							ipu_csc(mb8, rgb32, decoder.sgn, g_ipu_thresh);
 
-						switch (ipu_cmd.pos[2])
-						{
-							case 0:
-							case 1:
-								if (!slice_intra_DCT(0, (u8*)mb8.Y, DCT_stride, ipu_cmd.pos[2] == 1))
-								{
-									ipu_cmd.pos[2] = 1;
-									return false;
-								}
-								/* fall-through */
-
-							case 2:
-								if (!slice_intra_DCT(0, (u8*)mb8.Y + 8, DCT_stride, ipu_cmd.pos[2] == 2))
-								{
-									ipu_cmd.pos[2] = 2;
-									return false;
-								}
-								/* fall-through */
-
-							case 3:
-								if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset, DCT_stride, ipu_cmd.pos[2] == 3))
-								{
-									ipu_cmd.pos[2] = 3;
-									return false;
-								}
-								/* fall-through */
-
-							case 4:
-								if (!slice_intra_DCT(0, (u8*)mb8.Y + DCT_offset + 8, DCT_stride, ipu_cmd.pos[2] == 4))
-								{
-									ipu_cmd.pos[2] = 4;
-									return false;
-								}
-								/* fall-through */
-
-							case 5:
-								if (!slice_intra_DCT(1, (u8*)mb8.Cb, decoder_stride >> 1, ipu_cmd.pos[2] == 5))
-								{
-									ipu_cmd.pos[2] = 5;
-									return false;
-								}
-								/* fall-through */
-
-							case 6:
-								if (!slice_intra_DCT(2, (u8*)mb8.Cr, decoder_stride >> 1, ipu_cmd.pos[2] == 6))
-								{
-									ipu_cmd.pos[2] = 6;
-									return false;
-								}
-								break;
-							default:
-								break;
-						}
-
-						// Send The MacroBlock via DmaIpuFrom
-						ipu_csc(mb8, rgb32, decoder.sgn);
-
-						if (decoder.ofm == 0)
-							decoder.SetOutputTo(rgb32);
-						else
-						{
-							ipu_dither(rgb32, rgb16, decoder.dte);
-							decoder.SetOutputTo(rgb16);
+							if (decoder.ofm == 0)
+								decoder.SetOutputTo(rgb32);
+							else
+							{
+								ipu_dither(rgb32, rgb16, decoder.dte);
+								decoder.SetOutputTo(rgb16);
+							}
+							ipu_cmd.pos[1] = 2;
 						}
-						ipu_cmd.pos[1] = 2;
 
 						/* fallthrough */
 
@@ -1035,9 +1366,15 @@ __ri static bool mpeg2sliceIDEC(void)
 								IPUCoreStatus.WaitingOnIPUTo = false;
 								IPU_INT_PROCESS(64); // Should probably be much higher, but Myst 3 doesn't like it right now.
 								ipu_cmd.pos[1] = 2;
+								if (ipuThread.IsOpen())
+									IDECParseAhead();
 								return false;
 							}
 
+							// The macroblock parsed ahead stays with the IPU thread.
+							if (ipuThread.GetPending() > ((s_idec_ahead.next != IDEC_AHEAD_NONE) ? 1u : 0u))
+								IDECCollect();
+
 							uint read = ipu_fifo.out.write((u32*)decoder.GetIpuDataPtr(), decoder.ipu0_data);
 							decoder.AdvanceIpuDataBy(read);
 
@@ -1061,54 +1398,20 @@ __ri static bool mpeg2sliceIDEC(void)
 
 					case 3:
 						ready_to_decode = true;
-						for (;;)
-						{
-							if (!GETWORD())
-							{
-								ipu_cmd.pos[1] = 3;
-								return false;
-							}
-
-							code = UBITS(16);
-							if (code >= 0x1000)
-							{
-								mba = MBA.mba5 + (UBITS(5) - 2);
-								break;
-							}
-							else if (code >= 0x0300)
-							{
-								mba = MBA.mba11 + (UBITS(11) - 24);
-								break;
-							}
-							else switch (UBITS(11))
-							{
-								case 8:		/* macroblock_escape */
-									mbaCount += 33;
-									/* fall-through */
-
-								case 15:	/* macroblock_stuffing (MPEG1 only) */
-									DUMPBITS(11);
-									continue;
-
-								default:	/* end of slice/frame, or error? */
-									goto finish_idec;
-							}
-						}
-
-						DUMPBITS(mba->len);
-						mbaCount += mba->mba;
-
-						if (mbaCount)
-							decoder.dc_dct_pred[0] =
-							decoder.dc_dct_pred[1] =
-							decoder.dc_dct_pred[2] = 128 << decoder.intra_dc_precision;
+						ipu_cmd.pos[1] = 3;
+						if (IDECApplyAhead(IDEC_AHEAD_ADDRESS))
+							break;
 						/* fall-through */
 
 					case 4:
-						if (!GETWORD())
+						switch (IDECParseAddress())
 						{
-							ipu_cmd.pos[1] = 4;
-							return false;
+							case 0:
+								return false;
+							case -1:
+								goto finish_idec;
+							default:
+								break;
 						}
 						break;
 					default:
@@ -1674,7 +1977,7 @@ __ri static bool ipuCSC(tIPU_CMD_CSC csc)
 			if (!getBits64((u8*)&decoder.mb8 + 8 * ipu_cmd.pos[0])) return false;
 		}
 
-		ipu_csc(decoder.mb8, decoder.rgb32, 0);
+		ipu_csc(decoder.mb8, decoder.rgb32, 0, g_ipu_thresh);
 
 		if (csc.OFM)
 		{
@@ -1745,28 +2048,28 @@ __ri static bool ipuPACK(tIPU_CMD_CSC csc)
 //  CORE Functions (referenced from MPEG library)
 // --------------------------------------------------------------------------------------
 
-__fi static void ipu_csc(macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn)
+__fi static void ipu_csc(const macroblock_8& mb8, macroblock_rgb32& rgb32, int sgn, const u16* thresh)
 {
 	int i;
 	u8* p = (u8*)&rgb32;
 
-	yuv2rgb();
+	yuv2rgb(mb8, rgb32);
 
-	if (g_ipu_thresh[0] > 0)
+	if (thresh[0] > 0)
 	{
 		for (i = 0; i < 16*16; i++, p += 4)
 		{
-			if ((p[0] < g_ipu_thresh[0]) && (p[1] < g_ipu_thresh[0]) && (p[2] < g_ipu_thresh[0]))
+			if ((p[0] < thresh[0]) && (p[1] < thresh[0]) && (p[2] < thresh[0]))
 				*(u32*)p = 0;
-			else if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
+			else if ((p[0] < thresh[1]) && (p[1] < thresh[1]) && (p[2] < thresh[1]))
 				p[3] = 0x40;
 		}
 	}
-	else if (g_ipu_thresh[1] > 0)
+	else if (thresh[1] > 0)
 	{
 		for (i = 0; i < 16*16; i++, p += 4)
 		{
-			if ((p[0] < g_ipu_thresh[1]) && (p[1] < g_ipu_thresh[1]) && (p[2] < g_ipu_thresh[1]))
+			if ((p[0] < thresh[1]) && (p[1] < thresh[1]) && (p[2] < thresh[1]))
 				p[3] = 0x40;
 		}
 	}
@@ -1805,6 +2108,19 @@ __fi static void ipu_vq(macroblock_rgb16& rgb16, u8* indx4)
 			indx4[i * 8 + j] = closest_index(i, 2 * j + 1) << 4 | closest_index(i, 2 * j);
 }
 
+// Brings decoder back in line with the non-threaded path, so it can be saved or reused.
+void IPUThreadSync(void)
+{
+	IDECDropAhead();
+
+	if (ipuThread.GetPending())
+		IDECCollect();
+
+	IPUMacroblockJob& job = ipuThread.GetJob();
+	if (job.blocks_mask)
+		IDCT_CopyJobBlocks(job, decoder.mb8);
+}
+
 __noinline void IPUWorker(void)
 {
 	switch (ipu_cmd.CMD)
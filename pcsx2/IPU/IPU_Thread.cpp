@@ -0,0 +1,170 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include "common/Console.h"
+#include "common/Timer.h"
+
+#include "../Config.h"
+#include "../VMManager.h"
+
+#include "IPU_Thread.h"
+
+IPU_Thread ipuThread;
+
+IPU_Thread::IPU_Thread()
+{
+	std::memset(m_jobs, 0, sizeof(m_jobs));
+}
+
+IPU_Thread::~IPU_Thread()
+{
+	Close();
+}
+
+void IPU_Thread::ApplySettings()
+{
+	if (EmuConfig.Speedhacks.ipuThread)
+		Open();
+	else
+		Close();
+}
+
+void IPU_Thread::Open()
+{
+	if (IsOpen())
+		return;
+
+	m_sema.Reset();
+	while (m_done_sema.TryWait())
+		;
+	m_shutdown_flag.store(false, std::memory_order_release);
+	m_queued.store(0, std::memory_order_relaxed);
+	m_finished.store(0, std::memory_order_relaxed);
+	m_collected = 0;
+	for (IPUMacroblockJob& job : m_jobs)
+		job.blocks_mask = 0;
+	GetStats(true);
+
+	m_thread.SetStackSize(VMManager::EMU_THREAD_STACK_SIZE);
+	m_thread.Start([this]() { ThreadProc(); });
+	Console.WriteLn("(IPU) Started IDEC helper thread");
+}
+
+void IPU_Thread::Close()
+{
+	if (!IsOpen())
+		return;
+
+	// Whoever closes us is expected to have collected or retracted every job already.
+	m_shutdown_flag.store(true, std::memory_order_release);
+	m_sema.NotifyOfWork();
+	m_thread.Join();
+
+	LogStats();
+}
+
+void IPU_Thread::Submit()
+{
+	m_queued.store(m_queued.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	m_sema.NotifyOfWork();
+}
+
+IPUMacroblockJob& IPU_Thread::Collect()
+{
+	if (!m_done_sema.TryWait())
+	{
+		const u64 start = Common::Timer::GetCurrentValue();
+		m_done_sema.Wait();
+		m_stall_ticks += Common::Timer::GetCurrentValue() - start;
+		m_stalls++;
+	}
+
+	// Jobs finish in order, so any finished job means the oldest one is.
+	IPUMacroblockJob& job = m_jobs[m_collected % MAX_JOBS];
+	m_collected++;
+	m_macroblocks++;
+	return job;
+}
+
+void IPU_Thread::Retract()
+{
+	// Once the IPU thread is idle it has finished every job, the newest one included, and
+	// won't look at the counters again until more work comes in.
+	m_sema.WaitForEmpty();
+	m_done_sema.Wait();
+	m_queued.store(m_queued.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+	m_finished.store(m_finished.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+	m_retracted++;
+}
+
+IPU_Thread::Stats IPU_Thread::GetStats(bool reset)
+{
+	Stats stats;
+	stats.macroblocks = m_macroblocks;
+	stats.stalls = m_stalls;
+	stats.stall_ticks = m_stall_ticks;
+	stats.work_ticks = m_work_ticks.load(std::memory_order_relaxed);
+	stats.retracted = m_retracted;
+
+	if (reset)
+	{
+		m_macroblocks = 0;
+		m_stalls = 0;
+		m_stall_ticks = 0;
+		m_work_ticks.store(0, std::memory_order_relaxed);
+		m_retracted = 0;
+	}
+
+	return stats;
+}
+
+void IPU_Thread::LogStats()
+{
+	const Stats stats = GetStats(true);
+	if (stats.macroblocks == 0)
+		return;
+
+	Console.WriteLn("(IPU) %llu macroblocks on the helper thread, %.2f us each, EE waited on %llu (%.1f ms total), %llu parsed ahead for nothing",
+		static_cast<unsigned long long>(stats.macroblocks),
+		Common::Timer::ConvertValueToSeconds(stats.work_ticks) * 1e6 / static_cast<double>(stats.macroblocks),
+		static_cast<unsigned long long>(stats.stalls),
+		Common::Timer::ConvertValueToSeconds(stats.stall_ticks) * 1e3,
+		static_cast<unsigned long long>(stats.retracted));
+}
+
+void IPU_Thread::ThreadProc()
+{
+	for (;;)
+	{
+		m_sema.WaitForWork();
+		if (m_shutdown_flag.load(std::memory_order_acquire))
+			break;
+
+		u32 finished = m_finished.load(std::memory_order_relaxed);
+		while (finished != m_queued.load(std::memory_order_acquire))
+		{
+			IPUMacroblockJob& job = m_jobs[finished % MAX_JOBS];
+
+			const u64 start = Common::Timer::GetCurrentValue();
+			job.func(job);
+			m_work_ticks.fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
+
+			m_finished.store(++finished, std::memory_order_relaxed);
+			m_done_sema.Post();
+		}
+	}
+}
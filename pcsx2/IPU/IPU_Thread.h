@@ -0,0 +1,113 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common/Threading.h"
+
+#include "IPU_MultiISA.h"
+
+#include <atomic>
+
+// Everything IDEC needs to finish a macroblock once its bitstream has been parsed.
+struct alignas(16) IPUMacroblockJob
+{
+	s16 blocks[6][64];       // dequantised coefficients, in parse order (Y0 Y1 Y2 Y3 Cb Cr)
+	macroblock_8 mb8;
+	macroblock_rgb32 rgb32;
+	macroblock_rgb16 rgb16;
+	u16 thresh[2];
+	u8 blocks_mask;          // blocks captured into blocks[] and not transformed yet
+	bool interlaced;         // DCT_TYPE_INTERLACED, picks the Y block layout
+	bool sgn;
+	bool ofm;
+	bool dte;
+	void (*func)(IPUMacroblockJob& job);
+};
+
+// Runs the back half of IDEC (IDCT, colour space conversion and dithering) on a helper
+// thread. While it finishes a macroblock, the EE thread parses the next one ahead and sends
+// the macroblock before, see mpeg2sliceIDEC().
+//
+// Jobs are finished and collected in the order they were submitted. At most two are in
+// flight: the macroblock IDEC sends next and the one parsed ahead of it.
+class IPU_Thread final
+{
+public:
+	static constexpr u32 MAX_JOBS = 2;
+
+	struct Stats
+	{
+		u64 macroblocks; // macroblocks finished on the helper thread
+		u64 stalls;      // collections which had to wait for the helper thread
+		u64 stall_ticks; // time the EE thread spent waiting
+		u64 work_ticks;  // time the helper thread spent working
+		u64 retracted;   // jobs taken back because the macroblock parsed ahead went unused
+	};
+
+	IPU_Thread();
+	~IPU_Thread();
+
+	/// Returns true if the IPU thread has been started.
+	__fi bool IsOpen() const { return m_thread.Joinable(); }
+
+	/// Starts or stops the IPU thread to match the current settings.
+	void ApplySettings();
+
+	void Open();
+	void Close();
+
+	/// The job to build next. Only valid while CanSubmit().
+	__fi IPUMacroblockJob& GetJob() { return m_jobs[m_queued.load(std::memory_order_relaxed) % MAX_JOBS]; }
+
+	/// Returns the number of jobs submitted and not collected yet.
+	__fi u32 GetPending() const { return m_queued.load(std::memory_order_relaxed) - m_collected; }
+
+	/// Returns true if there's room for another job.
+	__fi bool CanSubmit() const { return GetPending() < MAX_JOBS; }
+
+	/// Hands the job from GetJob() to the IPU thread.
+	void Submit();
+
+	/// Waits for the oldest submitted job to finish and returns it.
+	IPUMacroblockJob& Collect();
+
+	/// Takes back the newest submitted job, once the IPU thread is done with it.
+	void Retract();
+
+	Stats GetStats(bool reset);
+
+private:
+	void ThreadProc();
+	void LogStats();
+
+	alignas(16) IPUMacroblockJob m_jobs[MAX_JOBS];
+
+	Threading::WorkSema m_sema;
+	Threading::UserspaceSemaphore m_done_sema; // posted once for every finished job
+	Threading::Thread m_thread;
+	std::atomic_bool m_shutdown_flag{false};
+	std::atomic<u32> m_queued{0};   // jobs submitted, written by the EE thread
+	std::atomic<u32> m_finished{0}; // jobs finished, written by the IPU thread
+	u32 m_collected = 0;
+
+	std::atomic<u64> m_work_ticks{0};
+	u64 m_macroblocks = 0;
+	u64 m_stalls = 0;
+	u64 m_stall_ticks = 0;
+	u64 m_retracted = 0;
+};
+
+extern IPU_Thread ipuThread;
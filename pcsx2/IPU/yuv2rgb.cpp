@@ -46,7 +46,7 @@
 
 MULTI_ISA_UNSHARED_START
 
-void yuv2rgb(void)
+void yuv2rgb(const macroblock_8& mb8, macroblock_rgb32& rgb32)
 {
 #if _M_SSE >= 0x200 /* SSE2 codepath */
 	// An AVX2 version is only slightly faster than an SSE2 version (+2-3fps)
@@ -71,8 +71,8 @@ void yuv2rgb(void)
 	for (int n = 0; n < 8; ++n) {
 		// could skip the loadl_epi64 but most SSE instructions require 128-bit
 		// alignment so two versions would be needed.
-		__m128i cb = _mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cb[n][0]));
-		__m128i cr = _mm_loadl_epi64(reinterpret_cast<__m128i*>(&decoder.mb8.Cr[n][0]));
+		__m128i cb = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&mb8.Cb[n][0]));
+		__m128i cr = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&mb8.Cr[n][0]));
 
 		// (Cb - 128) << 8, (Cr - 128) << 8
 		cb = _mm_xor_si128(cb, c_bias);
@@ -85,7 +85,7 @@ void yuv2rgb(void)
 		__m128i bc = _mm_mulhi_epi16(cb, bcb_coefficient);
 
 		for (int m = 0; m < 2; ++m) {
-			__m128i y = _mm_load_si128(reinterpret_cast<__m128i*>(&decoder.mb8.Y[n * 2 + m][0]));
+			__m128i y = _mm_load_si128(reinterpret_cast<const __m128i*>(&mb8.Y[n * 2 + m][0]));
 			y = _mm_subs_epu8(y, y_bias);
 			// Y << 8 for pixels 0, 2, 4, 6, 8, 10, 12, 14
 			__m128i y_even = _mm_slli_epi16(y, 8);
@@ -130,10 +130,10 @@ void yuv2rgb(void)
 			__m128i rgba_hl = _mm_unpacklo_epi16(rg_h, ba_h);
 			__m128i rgba_hh = _mm_unpackhi_epi16(rg_h, ba_h);
 
-			_mm_store_si128(reinterpret_cast<__m128i*>(&decoder.rgb32.c[n * 2 + m][0]), rgba_ll);
-			_mm_store_si128(reinterpret_cast<__m128i*>(&decoder.rgb32.c[n * 2 + m][4]), rgba_lh);
-			_mm_store_si128(reinterpret_cast<__m128i*>(&decoder.rgb32.c[n * 2 + m][8]), rgba_hl);
-			_mm_store_si128(reinterpret_cast<__m128i*>(&decoder.rgb32.c[n * 2 + m][12]), rgba_hh);
+			_mm_store_si128(reinterpret_cast<__m128i*>(&rgb32.c[n * 2 + m][0]), rgba_ll);
+			_mm_store_si128(reinterpret_cast<__m128i*>(&rgb32.c[n * 2 + m][4]), rgba_lh);
+			_mm_store_si128(reinterpret_cast<__m128i*>(&rgb32.c[n * 2 + m][8]), rgba_hl);
+			_mm_store_si128(reinterpret_cast<__m128i*>(&rgb32.c[n * 2 + m][12]), rgba_hh);
 		}
 	}
 #elif defined(_M_ARM64) /* ARM64 codepath */
@@ -157,8 +157,8 @@ void yuv2rgb(void)
 	{
 		// could skip the loadl_epi64 but most SSE instructions require 128-bit
 		// alignment so two versions would be needed.
-		int8x16_t cb = vcombine_s8(vld1_s8(reinterpret_cast<s8*>(&decoder.mb8.Cb[n][0])), vdup_n_s8(0));
-		int8x16_t cr = vcombine_s8(vld1_s8(reinterpret_cast<s8*>(&decoder.mb8.Cr[n][0])), vdup_n_s8(0));
+		int8x16_t cb = vcombine_s8(vld1_s8(reinterpret_cast<const s8*>(&mb8.Cb[n][0])), vdup_n_s8(0));
+		int8x16_t cr = vcombine_s8(vld1_s8(reinterpret_cast<const s8*>(&mb8.Cr[n][0])), vdup_n_s8(0));
 
 		// (Cb - 128) << 8, (Cr - 128) << 8
 		cb = veorq_s8(cb, c_bias);
@@ -172,7 +172,7 @@ void yuv2rgb(void)
 
 		for (int m = 0; m < 2; ++m)
 		{
-			uint8x16_t y = vld1q_u8(&decoder.mb8.Y[n * 2 + m][0]);
+			uint8x16_t y = vld1q_u8(&mb8.Y[n * 2 + m][0]);
 			y = vqsubq_u8(y, y_bias);
 			// Y << 8 for pixels 0, 2, 4, 6, 8, 10, 12, 14
 			int16x8_t y_even = vshlq_n_s16(vreinterpretq_s16_u8(y), 8);
@@ -229,17 +229,14 @@ void yuv2rgb(void)
 			uint16x8_t rgba_hl = vzip1q_u16(vreinterpretq_u16_u8(rg_h), vreinterpretq_u16_u8(ba_h));
 			uint16x8_t rgba_hh = vzip2q_u16(vreinterpretq_u16_u8(rg_h), vreinterpretq_u16_u8(ba_h));
 
-			vst1q_u8(reinterpret_cast<u8*>(&decoder.rgb32.c[n * 2 + m][0]), vreinterpretq_u8_u16(rgba_ll));
-			vst1q_u8(reinterpret_cast<u8*>(&decoder.rgb32.c[n * 2 + m][4]), vreinterpretq_u8_u16(rgba_lh));
-			vst1q_u8(reinterpret_cast<u8*>(&decoder.rgb32.c[n * 2 + m][8]), vreinterpretq_u8_u16(rgba_hl));
-			vst1q_u8(reinterpret_cast<u8*>(&decoder.rgb32.c[n * 2 + m][12]), vreinterpretq_u8_u16(rgba_hh));
+			vst1q_u8(reinterpret_cast<u8*>(&rgb32.c[n * 2 + m][0]), vreinterpretq_u8_u16(rgba_ll));
+			vst1q_u8(reinterpret_cast<u8*>(&rgb32.c[n * 2 + m][4]), vreinterpretq_u8_u16(rgba_lh));
+			vst1q_u8(reinterpret_cast<u8*>(&rgb32.c[n * 2 + m][8]), vreinterpretq_u8_u16(rgba_hl));
+			vst1q_u8(reinterpret_cast<u8*>(&rgb32.c[n * 2 + m][12]), vreinterpretq_u8_u16(rgba_hh));
 		}
 	}
 }
 #else /* Reference C implementation */
-	const macroblock_8& mb8 = decoder.mb8;
-	macroblock_rgb32& rgb32 = decoder.rgb32;
-
 	for (int y = 0; y < 16; y++)
 		for (int x = 0; x < 16; x++)
 		{
@@ -17,4 +17,7 @@
 
 #include "../GS/MultiISA.h"
 
-MULTI_ISA_DEF(extern void yuv2rgb(void);)
+struct macroblock_8;
+struct macroblock_rgb32;
+
+MULTI_ISA_DEF(extern void yuv2rgb(const macroblock_8& mb8, macroblock_rgb32& rgb32);)
@@ -14,6 +14,8 @@
  */
 
 #include "Common.h"
+#include "common/Console.h"
+#include "common/Timer.h"
 
 #include <atomic>
 #include <cstring>
@@ -71,6 +73,22 @@ namespace MTGS
 
 	static std::thread::id s_thread;
 	static std::atomic<bool> s_open_flag = false;
+
+	// Telemetry, see MTGS_RingStats. Packet counts and the high-water mark are only
+	// written by the GS thread, waits come from the EE and MTVU threads.
+	static struct
+	{
+		std::atomic<u32> high_water;
+		std::atomic<u64> frames;
+		std::atomic<u64> queue_stalls;
+		std::atomic<u64> queue_stall_ticks;
+		std::atomic<u64> wait_calls[static_cast<int>(MTGS_WaitReason::Count)];
+		std::atomic<u64> wait_ticks[static_cast<int>(MTGS_WaitReason::Count)];
+		std::atomic<u64> packets[GS_RINGTYPE_COUNT];
+		std::atomic<u64> start;
+	} s_stats;
+
+	static void LogRingStats();
 };
 
 bool MTGS::IsOpen() { return s_open_flag.load(std::memory_order_acquire); }
@@ -131,7 +149,10 @@ void MTGS::PostVsyncStart()
 	if (s_QueuedFrameCount.fetch_add(1) < EmuConfig.GS.VsyncQueueSize)
 		return;
 
+	const u64 start = Common::Timer::GetCurrentValue();
 	s_sem_Vsync.Wait();
+	s_stats.queue_stalls.fetch_add(1, std::memory_order_relaxed);
+	s_stats.queue_stall_ticks.fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
 }
 
 void MTGS::InitAndReadFIFO(u8* mem, u32 qwc)
@@ -154,7 +175,7 @@ void MTGS::InitAndReadFIFO(u8* mem, u32 qwc)
 	tag.pointer                 = (uptr)mem;
 
 	s_WritePos.store((writepos + 1) & RINGBUFFERMASK, std::memory_order_release);
-	WaitGS(false);
+	WaitGS(false, MTGS_WaitReason::ReadFIFO);
 }
 
 void MTGS::TryOpenGS(void)
@@ -162,6 +183,7 @@ void MTGS::TryOpenGS(void)
 	s_thread = std::this_thread::get_id();
 
 	GSopen(EmuConfig.GS, EmuConfig.GS.Renderer, hw_render.context_type, PS2MEM_GS);
+	ResetRingStats();
 
 	s_open_flag.store(true, std::memory_order_release);
 }
@@ -192,10 +214,23 @@ void MTGS::MainLoop(bool flush_all)
 
 		// note: s_ReadPos is intentionally not volatile, because it should only
 		// ever be modified by this thread.
-		while (s_ReadPos.load(std::memory_order_relaxed) != s_WritePos.load(std::memory_order_acquire))
+		for (;;)
 		{
 			const unsigned int local_ReadPos = s_ReadPos.load(std::memory_order_relaxed);
+			const unsigned int local_WritePos = s_WritePos.load(std::memory_order_acquire);
+			if (local_ReadPos == local_WritePos)
+				break;
+
+			const u32 queued = (local_WritePos - local_ReadPos) & RINGBUFFERMASK;
+			if (queued > s_stats.high_water.load(std::memory_order_relaxed))
+				s_stats.high_water.store(queued, std::memory_order_relaxed);
+
 			const PacketTagType& tag = (PacketTagType&)m_Ring[local_ReadPos];
+			if (tag.command < GS_RINGTYPE_COUNT)
+			{
+				std::atomic<u64>& count = s_stats.packets[tag.command];
+				count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			}
 
 			switch (tag.command)
 			{
@@ -236,6 +271,10 @@ void MTGS::MainLoop(bool flush_all)
 					s_QueuedFrameCount.fetch_sub(1);
 					if (s_VsyncSignalListener.exchange(false))
 						s_sem_Vsync.Post();
+
+					s_stats.frames.store(s_stats.frames.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					if (GSConfig.LogMTGSStats)
+						LogRingStats();
 					break;
 				case GS_RINGTYPE_FREEZE:
 					{
@@ -282,7 +321,7 @@ void MTGS::CloseGS(void)
 // Waits for the GS to empty out the entire ring buffer contents.
 // This function is allowed to exit after MTGS finished a path1 packet.
 // If isMTVU, then this implies this function is being called from the MTVU thread...
-void MTGS::WaitGS(bool isMTVU)
+void MTGS::WaitGS(bool isMTVU, MTGS_WaitReason reason)
 {
 	if(std::this_thread::get_id() == s_thread)
 	{
@@ -292,6 +331,7 @@ void MTGS::WaitGS(bool isMTVU)
 	if (!IsOpen()) /* WaitGS issued on a closed thread! */
 		return;
 
+	const u64 start = Common::Timer::GetCurrentValue();
 	s_sem_event.NotifyOfWork();
 	if (isMTVU)
 	{
@@ -320,6 +360,9 @@ void MTGS::WaitGS(bool isMTVU)
 		/* if it returns false, MTGS thread died */
 		if (!s_sem_event.WaitForEmpty()) { }
 	}
+
+	s_stats.wait_calls[static_cast<int>(reason)].fetch_add(1, std::memory_order_relaxed);
+	s_stats.wait_ticks[static_cast<int>(reason)].fetch_add(Common::Timer::GetCurrentValue() - start, std::memory_order_relaxed);
 }
 
 void MTGS::WaitForClose()
@@ -340,7 +383,7 @@ void MTGS::Freeze(FreezeAction mode, MTGS_FreezeData& data)
 	tag.pointer                 = (uptr)&data;
 
 	s_WritePos.store((writepos + 1) & RINGBUFFERMASK, std::memory_order_release);
-	WaitGS(false);
+	WaitGS(false, MTGS_WaitReason::Freeze);
 }
 
 void MTGS::GameChanged()
@@ -355,7 +398,7 @@ void MTGS::ApplySettings()
 	// is unsynchronized, because otherwise we might potentially read in the middle of
 	// the GS renderer being reopened.
 	if (EmuConfig.GS.HWDownloadMode == GSHardwareDownloadMode::Unsynchronized)
-		WaitGS(false);
+		WaitGS(false, MTGS_WaitReason::Settings);
 }
 
 void MTGS::SwitchRenderer(GSRendererType renderer, GSInterlaceMode interlace)
@@ -363,7 +406,70 @@ void MTGS::SwitchRenderer(GSRendererType renderer, GSInterlaceMode interlace)
 	GSSwitchRenderer(renderer, hw_render.context_type, interlace);
 	// See note in ApplySettings() for reasoning here.
 	if (EmuConfig.GS.HWDownloadMode == GSHardwareDownloadMode::Unsynchronized)
-		WaitGS(false);
+		WaitGS(false, MTGS_WaitReason::Settings);
+}
+
+MTGS_RingStats MTGS::GetRingStats()
+{
+	MTGS_RingStats stats;
+	stats.ring_size = RINGBUFFERSIZE;
+	stats.high_water = s_stats.high_water.load(std::memory_order_relaxed);
+	stats.frames = s_stats.frames.load(std::memory_order_relaxed);
+	stats.queue_stalls = s_stats.queue_stalls.load(std::memory_order_relaxed);
+	stats.queue_stall_ticks = s_stats.queue_stall_ticks.load(std::memory_order_relaxed);
+	for (int i = 0; i < static_cast<int>(MTGS_WaitReason::Count); i++)
+	{
+		stats.wait_calls[i] = s_stats.wait_calls[i].load(std::memory_order_relaxed);
+		stats.wait_ticks[i] = s_stats.wait_ticks[i].load(std::memory_order_relaxed);
+	}
+	for (int i = 0; i < GS_RINGTYPE_COUNT; i++)
+		stats.packets[i] = s_stats.packets[i].load(std::memory_order_relaxed);
+	stats.ticks = Common::Timer::GetCurrentValue() - s_stats.start.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void MTGS::ResetRingStats()
+{
+	// Counts which land while this runs end up in either interval, close enough for telemetry.
+	s_stats.high_water.store(0, std::memory_order_relaxed);
+	s_stats.frames.store(0, std::memory_order_relaxed);
+	s_stats.queue_stalls.store(0, std::memory_order_relaxed);
+	s_stats.queue_stall_ticks.store(0, std::memory_order_relaxed);
+	for (int i = 0; i < static_cast<int>(MTGS_WaitReason::Count); i++)
+	{
+		s_stats.wait_calls[i].store(0, std::memory_order_relaxed);
+		s_stats.wait_ticks[i].store(0, std::memory_order_relaxed);
+	}
+	for (int i = 0; i < GS_RINGTYPE_COUNT; i++)
+		s_stats.packets[i].store(0, std::memory_order_relaxed);
+	s_stats.start.store(Common::Timer::GetCurrentValue(), std::memory_order_relaxed);
+}
+
+// Called on the GS thread every vsync, writes the counters out once a second.
+void MTGS::LogRingStats()
+{
+	const u64 start = s_stats.start.load(std::memory_order_relaxed);
+	if (Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - start) < 1.0)
+		return;
+
+	const MTGS_RingStats stats = GetRingStats();
+	ResetRingStats();
+
+	const double frames = static_cast<double>(std::max<u64>(stats.frames, 1));
+	const auto ms = [](u64 ticks) { return Common::Timer::ConvertValueToSeconds(ticks) * 1e3; };
+	Console.WriteLn("MTGS: %llu frames, ring high-water %u/%u, queue stalls %llu (%.2f ms)",
+		static_cast<unsigned long long>(stats.frames), stats.high_water, stats.ring_size,
+		static_cast<unsigned long long>(stats.queue_stalls), ms(stats.queue_stall_ticks));
+	Console.WriteLn("MTGS: WaitGS sync %llu (%.2f ms), gif buffer %llu (%.2f ms), read fifo %llu (%.2f ms), freeze %llu (%.2f ms), settings %llu (%.2f ms)",
+		static_cast<unsigned long long>(stats.wait_calls[static_cast<int>(MTGS_WaitReason::Sync)]), ms(stats.wait_ticks[static_cast<int>(MTGS_WaitReason::Sync)]),
+		static_cast<unsigned long long>(stats.wait_calls[static_cast<int>(MTGS_WaitReason::GifBuffer)]), ms(stats.wait_ticks[static_cast<int>(MTGS_WaitReason::GifBuffer)]),
+		static_cast<unsigned long long>(stats.wait_calls[static_cast<int>(MTGS_WaitReason::ReadFIFO)]), ms(stats.wait_ticks[static_cast<int>(MTGS_WaitReason::ReadFIFO)]),
+		static_cast<unsigned long long>(stats.wait_calls[static_cast<int>(MTGS_WaitReason::Freeze)]), ms(stats.wait_ticks[static_cast<int>(MTGS_WaitReason::Freeze)]),
+		static_cast<unsigned long long>(stats.wait_calls[static_cast<int>(MTGS_WaitReason::Settings)]), ms(stats.wait_ticks[static_cast<int>(MTGS_WaitReason::Settings)]));
+	Console.WriteLn("MTGS: packets per frame: gs %.1f, mtvu %.1f, vsync %.1f, read fifo %.1f, freeze %.1f, reset %.1f",
+		stats.packets[GS_RINGTYPE_GSPACKET] / frames, stats.packets[GS_RINGTYPE_MTVU_GSPACKET] / frames,
+		stats.packets[GS_RINGTYPE_VSYNC] / frames, stats.packets[GS_RINGTYPE_INIT_AND_READ_FIFO] / frames,
+		stats.packets[GS_RINGTYPE_FREEZE] / frames, stats.packets[GS_RINGTYPE_RESET] / frames);
 }
 
 // Adds a finished GS Packet to the MTGS ring buffer
@@ -211,6 +211,13 @@ void VU_Thread::ExecuteRingBuffer(void)
 
 			m_ato_read_pos.store(m_read_pos, std::memory_order_release);
 		}
+
+		// Nothing left to run, precompile saved microVU entry points one at a time until
+		// more work shows up.
+		while (m_ato_read_pos.load(std::memory_order_relaxed) == GetWritePos() &&
+			   !m_shutdown_flag.load(std::memory_order_acquire) && mVUdiskCacheWarmIdle(1, 1))
+		{
+		}
 	}
 
 	semaEvent.Kill();
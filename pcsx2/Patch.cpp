@@ -32,25 +32,6 @@
 
 #include <file/file_path.h>
 
-enum patch_cpu_type {
-	NO_CPU = 0,
-	CPU_EE,
-	CPU_IOP
-};
-
-enum patch_data_type {
-	NO_TYPE = 0,
-	BYTE_T,
-	SHORT_T,
-	WORD_T,
-	DOUBLE_T,
-	EXTENDED_T,
-	SHORT_LE_T,
-	WORD_LE_T,
-	DOUBLE_LE_T
-};
-
-
 static u32 SkipCount          = 0;
 static u32 IterationCount     = 0;
 static u32 IterationIncrement = 0;
@@ -713,6 +694,11 @@ static void inifile_command(const std::string& cmd)
 	/*int code = */ PatchTableExecute(key, value, commands_patch);
 }
 
+void LoadPatchesFromTable(const IniPatch* patches, size_t count)
+{
+	Patch.insert(Patch.end(), patches, patches + count);
+}
+
 int LoadPatchesFromString(const std::string& patches)
 {
 	const size_t before = Patch.size();
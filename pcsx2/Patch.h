@@ -62,6 +62,24 @@
 #define PPT_COMBINED_0_1 2
 #define _PPT_END_MARKER  3
 
+enum patch_cpu_type {
+	NO_CPU = 0,
+	CPU_EE,
+	CPU_IOP
+};
+
+enum patch_data_type {
+	NO_TYPE = 0,
+	BYTE_T,
+	SHORT_T,
+	WORD_T,
+	DOUBLE_T,
+	EXTENDED_T,
+	SHORT_LE_T,
+	WORD_LE_T,
+	DOUBLE_LE_T
+};
+
 typedef void PATCHTABLEFUNC(const std::string_view& text1, const std::string_view& text2);
 
 struct IniPatch
@@ -100,6 +118,8 @@ extern std::vector<IniPatch> Patch;
 // - do not reset/unload previously loaded patches (use ForgetLoadedPatches() for that)
 // - do not actually patch the emulation memory (that happens at ApplyLoadedPatches(...) )
 extern int  LoadPatchesFromString(const std::string& patches);
+// Adds patches which were already decoded (e.g. built-in tables), skipping the text parser.
+extern void LoadPatchesFromTable(const IniPatch* patches, size_t count);
 extern int  LoadPatchesFromDir(const std::string& crc, const std::string& folder, const char* friendly_name, bool show_error_when_missing);
 extern int  LoadPatchesFromZip(const std::string& crc, const u8* zip_data, size_t zip_data_size);
 
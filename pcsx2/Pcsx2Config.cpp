@@ -203,6 +203,7 @@ void Pcsx2Config::SpeedhackOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(vuFlagHack);
 	SettingsWrapBitBool(vuThread);
 	SettingsWrapBitBool(vu1Instant);
+	SettingsWrapBitBool(ipuThread);
 
 	EECycleRate = std::clamp(EECycleRate, MIN_EE_CYCLE_RATE, MAX_EE_CYCLE_RATE);
 	EECycleSkip = std::min(EECycleSkip, MAX_EE_CYCLE_SKIP);
@@ -220,6 +221,7 @@ Pcsx2Config::RecompilerOptions::RecompilerOptions()
 	EnableVU0 = true;
 	EnableVU1 = true;
 	EnableFastmem = true;
+	ProfileIOPBlocks = false;
 
 	// vu and fpu clamping default to standard overflow.
 	vu0Overflow = true;
@@ -297,6 +299,7 @@ void Pcsx2Config::RecompilerOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(EnableVU0);
 	SettingsWrapBitBool(EnableVU1);
 	SettingsWrapBitBool(EnableFastmem);
+	SettingsWrapBitBool(ProfileIOPBlocks);
 
 	SettingsWrapBitBool(vu0Overflow);
 	SettingsWrapBitBool(vu0ExtraOverflow);
@@ -431,6 +434,9 @@ Pcsx2Config::GSOptions::GSOptions()
 	LoadTextureReplacements = false;
 	LoadTextureReplacementsAsync = true;
 	PrecacheTextureReplacements = false;
+
+	SWWorkStealing = false;
+	LogMTGSStats = false;
 }
 
 bool Pcsx2Config::GSOptions::operator==(const GSOptions& right) const
@@ -556,6 +562,8 @@ void Pcsx2Config::GSOptions::LoadSave(SettingsWrapper& wrap)
 	SettingsWrapBitBool(LoadTextureReplacements);
 	SettingsWrapBitBool(LoadTextureReplacementsAsync);
 	SettingsWrapBitBool(PrecacheTextureReplacements);
+	SettingsWrapBitBoolEx(SWWorkStealing, "sw_work_stealing");
+	SettingsWrapBitBool(LogMTGSStats);
 
 	SettingsWrapIntEnumEx(InterlaceMode, "deinterlace_mode");
 
@@ -949,6 +957,8 @@ void Pcsx2Config::LoadSave(SettingsWrapper& wrap)
 	Gamefixes.LoadSave(wrap);
 
 	SettingsWrapEntry(GzipIsoIndexTemplate);
+	SettingsWrapEntry(CdvdCacheSize);
+	SettingsWrapEntry(CdvdReadAhead);
 
 	BaseFilenames.LoadSave(wrap);
 	Framerate.LoadSave(wrap);
@@ -1006,7 +1016,9 @@ bool Pcsx2Config::operator==(const Pcsx2Config& right) const
 		OpEqu(Gamefixes) &&
 		OpEqu(Framerate) &&
 		OpEqu(BaseFilenames) &&
-		OpEqu(GzipIsoIndexTemplate);
+		OpEqu(GzipIsoIndexTemplate) &&
+		OpEqu(CdvdCacheSize) &&
+		OpEqu(CdvdReadAhead);
 	for (u32 i = 0; i < sizeof(Mcd) / sizeof(Mcd[0]); i++)
 	{
 		equal &= OpEqu(Mcd[i].Enabled);
@@ -52,6 +52,7 @@ void SPU2::Open()
 	lClocks = psxRegs.cycle;
 
 	SPU2_InternalReset(false);
+	SPU2::ClearOutput();
 }
 
 void SPU2::Close() { }
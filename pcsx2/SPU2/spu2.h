@@ -35,6 +35,15 @@ namespace SPU2
 
 	/// Returns true if we're currently running in PSX mode.
 	bool IsRunningPSXMode(void);
+
+	/// Moves the samples mixed so far into the buffer FlushOutput() reads, call on the CPU thread.
+	void PushOutput(void);
+
+	/// Hands every sample pushed since the last call to the frontend in one batch, call once per retro_run().
+	void FlushOutput(void);
+
+	/// Throws away mixed samples which haven't been handed to the frontend yet.
+	void ClearOutput(void);
 } // namespace SPU2
 
 void SPU2write(u32 mem, u16 value);
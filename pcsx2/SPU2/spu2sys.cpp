@@ -28,9 +28,12 @@
 #include "Global.h"
 #include "spu2.h"
 
+#include <mutex>
+#include <vector>
+
 #include <libretro.h>
 
-extern retro_audio_sample_t sample_cb;
+extern retro_audio_sample_batch_t batch_cb;
 
 s16 spu2regs[0x010000 / sizeof(s16)];
 s16 _spu2mem[0x200000 / sizeof(s16)];
@@ -181,6 +184,80 @@ void V_Core::Init(int index)
 	memset(RevbUpBuf, 0, sizeof(RevbUpBuf));
 }
 
+// --------------------------------------------------------------------------------------
+//  Output stage
+// --------------------------------------------------------------------------------------
+// Mixed samples are produced on the CPU thread, but the frontend wants them from retro_run().
+// They are gathered into a small chunk without locking, and the chunk is moved into the
+// shared frame buffer when it fills up, so the lock is only taken every few hundred samples.
+// Only the CPU thread touches the chunk, it pushes what's left of it at every vsync.
+
+static constexpr u32 OUTPUT_CHUNK_SIZE = 256;
+// Half a second at 48KHz, stops the buffer growing forever when the frontend stops pulling.
+static constexpr u32 OUTPUT_BUFFER_LIMIT = 24000;
+
+static StereoOut16 s_output_chunk[OUTPUT_CHUNK_SIZE];
+static u32 s_output_chunk_pos = 0;
+
+static std::mutex s_output_mutex;
+static std::vector<StereoOut16> s_output_buffer;
+static std::vector<StereoOut16> s_output_flush_buffer;
+
+static void SPU2_PushOutputChunk(void)
+{
+	std::unique_lock lock(s_output_mutex);
+	const size_t room = (s_output_buffer.size() < OUTPUT_BUFFER_LIMIT) ? (OUTPUT_BUFFER_LIMIT - s_output_buffer.size()) : 0;
+	const size_t count = std::min<size_t>(s_output_chunk_pos, room);
+	s_output_buffer.insert(s_output_buffer.end(), s_output_chunk, s_output_chunk + count);
+	s_output_chunk_pos = 0;
+}
+
+static __forceinline void SPU2_OutputSample(s16 left, s16 right)
+{
+	s_output_chunk[s_output_chunk_pos].Left = left;
+	s_output_chunk[s_output_chunk_pos].Right = right;
+	if (++s_output_chunk_pos == OUTPUT_CHUNK_SIZE)
+		SPU2_PushOutputChunk();
+}
+
+void SPU2::PushOutput(void)
+{
+	if (s_output_chunk_pos > 0)
+		SPU2_PushOutputChunk();
+}
+
+void SPU2::FlushOutput(void)
+{
+	{
+		std::unique_lock lock(s_output_mutex);
+		s_output_flush_buffer.swap(s_output_buffer);
+	}
+
+	if (batch_cb)
+	{
+		static_assert(sizeof(StereoOut16) == sizeof(s16) * 2);
+		const s16* data = reinterpret_cast<const s16*>(s_output_flush_buffer.data());
+		size_t frames = s_output_flush_buffer.size();
+		while (frames > 0)
+		{
+			const size_t written = batch_cb(data, frames);
+			if (written == 0)
+				break;
+			data += written * 2;
+			frames -= std::min(written, frames);
+		}
+	}
+
+	s_output_flush_buffer.clear();
+}
+
+void SPU2::ClearOutput(void)
+{
+	std::unique_lock lock(s_output_mutex);
+	s_output_buffer.clear();
+	s_output_chunk_pos = 0;
+}
+
 #define TICKINTERVAL 768
 #define SANITYINTERVAL 4800
 /* TICKINTERVAL * SANITYINTERVAL = 3686400 */
@@ -209,8 +286,6 @@ __forceinline void TimeUpdate(u32 cClocks)
 
 	short snd_buffer[2];
 
-	snd_buffer[0] = snd_buffer[1] = 0;
-
 	//Update Mixing Progress
 	while (dClocks >= TICKINTERVAL)
 	{
@@ -271,11 +346,9 @@ __forceinline void TimeUpdate(u32 cClocks)
 			}
 		}
 		Mix(&snd_buffer[0], &snd_buffer[1]);
+		SPU2_OutputSample(snd_buffer[0], snd_buffer[1]);
 	}
 
-	if (sample_cb && snd_buffer[0] != 0 && snd_buffer[1] != 0)
-		sample_cb(snd_buffer[0], snd_buffer[1]);
-
 	//Update DMA4 interrupt delay counter
 	if (Cores[0].DMAICounter > 0 && (psxRegs.cycle - Cores[0].LastClock) > 0)
 	{
@@ -40,24 +40,16 @@
 // --------------------------------------------------------------------------------------
 //  SaveStateBase  (implementations)
 // --------------------------------------------------------------------------------------
-SaveStateBase::SaveStateBase( std::vector<u8>& memblock )
-	: m_memory(memblock) { }
+SaveStateBase::SaveStateBase( u8* memory, size_t size )
+	: m_memory(memory), m_memory_size(size) { }
 
 void SaveStateBase::PrepBlock(int size)
 {
 	if (m_error)
 		return;
-	const int end = m_idx+size;
-	if (IsSaving())
-	{
-		if (static_cast<u32>(end) >= m_memory.size())
-			m_memory.resize(static_cast<u32>(end));
-	}
-	else
-	{
-		if (m_memory.size() < static_cast<u32>(end))
-			m_error = true;
-	}
+	const size_t end = static_cast<size_t>(m_idx) + static_cast<size_t>(size);
+	if (end > m_memory_size && !(IsSaving() && Grow(end)))
+		m_error = true;
 }
 
 bool SaveStateBase::FreezeTag(const char *src)
@@ -178,16 +170,28 @@ bool SaveStateBase::FreezeInternals()
 // --------------------------------------------------------------------------------------
 // uncompressed to/from memory state saves implementation
 
-memSavingState::memSavingState( std::vector<u8>& save_to ) : SaveStateBase( save_to ) { }
+memSavingState::memSavingState( std::vector<u8>& save_to )
+	: SaveStateBase( save_to.data(), save_to.size() )
+	, m_vector( save_to )
+{
+}
+
+bool memSavingState::Grow(size_t size)
+{
+	m_vector.resize(size);
+	m_memory = m_vector.data();
+	m_memory_size = m_vector.size();
+	return true;
+}
 
 // Saving of state data
 void memSavingState::FreezeMem(void* data, int size)
 {
 	if (!size) return;
 
-	const int new_size = m_idx + size;
-	if (static_cast<u32>(new_size) > m_memory.size())
-		m_memory.resize(static_cast<u32>(new_size));
+	const size_t new_size = static_cast<size_t>(m_idx) + static_cast<size_t>(size);
+	if (new_size > m_memory_size)
+		Grow(new_size);
 
 	memcpy(&m_memory[m_idx], data, size);
 	m_idx += size;
@@ -197,11 +201,14 @@ void memSavingState::FreezeMem(void* data, int size)
 //  memLoadingState  (implementations)
 // --------------------------------------------------------------------------------------
 memLoadingState::memLoadingState( const std::vector<u8>& load_from )
-	: SaveStateBase( const_cast<std::vector<u8>&>(load_from) ) { }
+	: SaveStateBase( const_cast<u8*>(load_from.data()), load_from.size() ) { }
 
 // Loading of state data from a memory buffer...
 void memLoadingState::FreezeMem(void* data, int size)
 {
+	if (!m_error && static_cast<size_t>(m_idx) + static_cast<size_t>(size) > m_memory_size)
+		m_error = true;
+
 	if (m_error)
 	{
 		memset(data, 0, size);
@@ -213,6 +220,63 @@ void memLoadingState::FreezeMem(void* data, int size)
 	memcpy(data, src, size);
 }
 
+// --------------------------------------------------------------------------------------
+//  memSpanSavingState / memSpanLoadingState  (implementations)
+// --------------------------------------------------------------------------------------
+memSpanSavingState::memSpanSavingState( void* save_to, size_t size )
+	: SaveStateBase( static_cast<u8*>(save_to), size ) { }
+
+void memSpanSavingState::FreezeMem(void* data, int size)
+{
+	if (!size || m_error)
+		return;
+
+	if (static_cast<size_t>(m_idx) + static_cast<size_t>(size) > m_memory_size)
+	{
+		m_error = true;
+		return;
+	}
+
+	memcpy(&m_memory[m_idx], data, size);
+	m_idx += size;
+}
+
+memSpanLoadingState::memSpanLoadingState( const void* load_from, size_t size )
+	: SaveStateBase( const_cast<u8*>(static_cast<const u8*>(load_from)), size ) { }
+
+void memSpanLoadingState::FreezeMem(void* data, int size)
+{
+	if (!m_error && static_cast<size_t>(m_idx) + static_cast<size_t>(size) > m_memory_size)
+		m_error = true;
+
+	if (m_error)
+	{
+		memset(data, 0, size);
+		return;
+	}
+
+	memcpy(data, &m_memory[m_idx], size);
+	m_idx += size;
+}
+
+// --------------------------------------------------------------------------------------
+//  memSizingState  (implementations)
+// --------------------------------------------------------------------------------------
+memSizingState::memSizingState()
+	: SaveStateBase( nullptr, 0 ) { }
+
+bool memSizingState::Grow(size_t size)
+{
+	// Nothing is stored, so every block "fits".
+	m_memory_size = size;
+	return true;
+}
+
+void memSizingState::FreezeMem(void* data, int size)
+{
+	m_idx += size;
+}
+
 // --------------------------------------------------------------------------------------
 //  BaseSavestateEntry
 // --------------------------------------------------------------------------------------
@@ -52,21 +52,30 @@ struct freezeData
 //  SaveStateBase class
 // --------------------------------------------------------------------------------------
 // Provides the base API for both loading and saving savestates.  Normally you'll want to
-// use one of the four "functional" derived classes rather than this class directly: gzLoadingState, gzSavingState (gzipped disk-saved
-// states), and memLoadingState, memSavingState (uncompressed memory states).
+// use one of the functional derived classes rather than this class directly: memLoadingState,
+// memSavingState (uncompressed states in a growable vector), memSpanLoadingState,
+// memSpanSavingState (uncompressed states in a caller-owned buffer) and memSizingState.
 class SaveStateBase
 {
 protected:
-	std::vector<u8>& m_memory;
+	u8* m_memory = nullptr;  // current view of the backing store
+	size_t m_memory_size = 0;
 	char m_tagspace[32];
 
 	int m_idx = 0;			// current read/write index of the allocation
 	bool m_error = false; // error occurred while reading/writing
 
+	SaveStateBase( u8* memory, size_t size );
+
+	// Makes room for at least size bytes when saving. Only states which own a growable
+	// backing store can do that, everything else flags an overflow.
+	virtual bool Grow( size_t size ) { return false; }
+
 public:
-	SaveStateBase( std::vector<u8>& memblock );
 	virtual ~SaveStateBase() { }
 
+	// Total number of bytes read or written so far.
+	size_t GetSize() const { return static_cast<size_t>(m_idx); }
 	__fi bool IsOkay() const { return !m_error; }
 
 	bool FreezeBios();
@@ -114,12 +123,12 @@ public:
 
 	u8* GetBlockPtr()
 	{
-		return &m_memory[m_idx];
+		return m_memory + m_idx;
 	}
 
 	u8* GetPtrEnd() const
 	{
-		return &m_memory[m_idx];
+		return m_memory + m_idx;
 	}
 
 	void CommitBlock( int size )
@@ -147,8 +156,6 @@ public:
 	bool gsFreeze();
 
 protected:
-	void Init( std::vector<u8>* memblock );
-
 	// Load/Save functions for the various components of our glorious emulator!
 	//bool vmFreeze();
 	bool mtvuFreeze();
@@ -190,6 +197,10 @@ protected:
 	// 8 meg base alloc when PS2 main memory is excluded
 	static const int MemoryBaseAllocSize	= _8mb;
 
+	std::vector<u8>& m_vector;
+
+	bool Grow( size_t size ) override;
+
 public:
 	virtual ~memSavingState() = default;
 	memSavingState( std::vector<u8>& save_to );
@@ -209,3 +220,43 @@ public:
 
 	bool IsSaving() const { return false; }
 };
+
+// Saves straight into a fixed buffer (e.g. the one handed to retro_serialize), without an
+// intermediate copy. Running out of room flags an error instead of reallocating.
+class memSpanSavingState : public SaveStateBase
+{
+public:
+	virtual ~memSpanSavingState() = default;
+	memSpanSavingState( void* save_to, size_t size );
+
+	void FreezeMem( void* data, int size );
+
+	bool IsSaving() const { return true; }
+};
+
+class memSpanLoadingState : public SaveStateBase
+{
+public:
+	virtual ~memSpanLoadingState() = default;
+	memSpanLoadingState( const void* load_from, size_t size );
+
+	void FreezeMem( void* data, int size );
+
+	bool IsSaving() const { return false; }
+};
+
+// Walks a save without storing anything, so GetSize() gives the exact size of the state.
+// There is no backing store; callers must not touch GetBlockPtr() on it.
+class memSizingState : public SaveStateBase
+{
+protected:
+	bool Grow( size_t size ) override;
+
+public:
+	virtual ~memSizingState() = default;
+	memSizingState();
+
+	void FreezeMem( void* data, int size );
+
+	bool IsSaving() const { return true; }
+};
@@ -0,0 +1,722 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "../common/Console.h"
+#include "../common/General.h"
+#include "../common/Timer.h"
+
+#include "SaveState.h"
+#include "SaveStateDelta.h"
+
+namespace SaveStateDelta
+{
+	static constexpr u32 MAGIC = 0x544C4450; // 'PDLT'
+	static constexpr u32 VERSION = 2;
+
+	// A new keyframe is started once more than this fraction of the pages differ.
+	static constexpr u32 REKEY_DIVISOR = 4;
+
+	// Keyframes which deltas still being held may need. Past this, full states are
+	// written until a newer state is loaded and lets the older keyframes go. Doesn't
+	// apply to the rewind ring, which is bounded by its memory budget instead.
+	static constexpr u32 KEYFRAME_LIMIT = 4;
+
+	static constexpr u32 FLAG_FULL = 1; // the whole state follows the header
+
+	static constexpr size_t NO_OFFSET = ~static_cast<size_t>(0);
+
+#pragma pack(push, 1)
+	struct Header
+	{
+		u32 magic;
+		u32 version;
+		u64 session;
+		u64 serial;      // which Save() wrote it
+		u64 keyframe_id; // 0 for a full state which isn't a keyframe
+		u32 state_size;
+		u32 flags;
+		u32 page_count; // followed by page_count u32 page indices, then the pages
+	};
+#pragma pack(pop)
+	static_assert(sizeof(Header) <= HEADER_RESERVE);
+
+	struct Region
+	{
+		u8* base = nullptr;
+		u32 view_count = 0;
+		size_t size = 0;
+		u32 page_count = 0;
+		ProtectFn protect = nullptr;
+		std::vector<u8> dirty;     // written since the last save or load
+		std::vector<u8> since_key; // written since the current keyframe
+		size_t offset = NO_OFFSET; // where the last state holds it in the scratch buffer
+		bool in_state = false;     // copied by the save or load in progress
+	};
+
+	struct Keyframe
+	{
+		u64 id = 0;
+		size_t state_size = 0;
+		size_t offsets[TRACK_COUNT];
+		std::vector<u8> data; // padded to a whole number of pages
+	};
+
+	enum class Mode
+	{
+		None,
+		Save,
+		FastLoad,
+	};
+
+	static size_t PageAlign(size_t size);
+	static void ProtectPages(Region& r, u32 first, u32 count, bool writable);
+	static void ProtectRuns(Region& r, u8 dirty, bool writable);
+	static void StartTracking(void);
+	static void CommitTracked(void);
+	static void InvalidateScratch(void);
+	static bool SameLayout(const Keyframe& kf);
+	static bool PageChanged(u32 page, const Keyframe& kf);
+	static void StartKeyframe(size_t state_size);
+	static void DropOldestKeyframe(void);
+	static void ReleaseKeyframes(u64 id);
+	static Keyframe* FindKeyframe(u64 id);
+	static bool Encode(void* out, size_t out_size, size_t* written);
+	static bool Rebuild(const Header& header, const u8* payload, size_t payload_size);
+
+	static Region s_regions[TRACK_COUNT];
+	static bool s_tracking = false;
+	static Mode s_mode = Mode::None;
+
+	// The last state written or loaded. Tracked memory equals it on every clean page.
+	static std::vector<u8> s_scratch;
+	static size_t s_scratch_size = 0; // 0 when the scratch buffer holds no usable state
+	static std::vector<u32> s_changed_pages;
+
+	static std::deque<Keyframe> s_keyframes; // oldest first
+	static std::vector<u8> s_spare;          // storage of a released keyframe, reused by the next
+	static size_t s_keyframe_bytes = 0;      // held by s_keyframes
+	static size_t s_rewind_budget = 0;       // 0 outside of the rewind ring
+	static u64 s_next_keyframe_id = 1;
+	static u64 s_next_serial = 1;
+	static u64 s_last_serial = 0;
+	static u64 s_session = 0;
+	static Stats s_stats = {};
+} // namespace SaveStateDelta
+
+size_t SaveStateDelta::PageAlign(size_t size)
+{
+	return (size + DELTA_PAGE_SIZE - 1) & ~static_cast<size_t>(DELTA_PAGE_SIZE - 1);
+}
+
+void SaveStateDelta::ProtectPages(Region& r, u32 first, u32 count, bool writable)
+{
+	if (r.protect)
+	{
+		r.protect(first, count, writable);
+		return;
+	}
+
+	PageProtectionMode mode;
+	mode.m_read = true;
+	mode.m_write = writable;
+	mode.m_exec = false;
+	for (u32 view = 0; view < r.view_count; view++)
+	{
+		HostSys::MemProtect(r.base + view * r.size + (static_cast<size_t>(first) << __pageshift),
+			static_cast<size_t>(count) << __pageshift, mode);
+	}
+}
+
+// Changes the protection of every run of pages whose dirty flag matches.
+void SaveStateDelta::ProtectRuns(Region& r, u8 dirty, bool writable)
+{
+	u32 page = 0;
+	while (page < r.page_count)
+	{
+		if (r.dirty[page] != dirty)
+		{
+			page++;
+			continue;
+		}
+
+		const u32 first = page;
+		while (page < r.page_count && r.dirty[page] == dirty)
+			page++;
+		ProtectPages(r, first, page - first, writable);
+	}
+}
+
+void SaveStateDelta::RegisterTracked(TrackedMemory id, u8* base, u32 view_count, size_t size, ProtectFn protect)
+{
+	Region& r = s_regions[id];
+	r.base = base;
+	r.view_count = view_count;
+	r.size = size;
+	r.page_count = static_cast<u32>(size >> __pageshift);
+	r.protect = protect;
+
+	// Nothing is protected until it's been saved.
+	r.dirty.assign(r.page_count, 1);
+	r.since_key.assign(r.page_count, 1);
+	r.offset = NO_OFFSET;
+	r.in_state = false;
+}
+
+void SaveStateDelta::UnregisterTracked(TrackedMemory id)
+{
+	Region& r = s_regions[id];
+	if (!r.base)
+		return;
+
+	if (s_tracking)
+		ProtectRuns(r, 0, true);
+	r = Region();
+}
+
+bool SaveStateDelta::TrackWrite(TrackedMemory id, u32 page)
+{
+	Region& r = s_regions[id];
+	if (!s_tracking || !r.base || page >= r.page_count || r.dirty[page])
+		return false;
+
+	r.dirty[page] = 1;
+	ProtectPages(r, page, 1, true);
+	return true;
+}
+
+bool SaveStateDelta::HandleWriteFault(uptr addr)
+{
+	for (Region& r : s_regions)
+	{
+		if (!r.base || addr < reinterpret_cast<uptr>(r.base) || addr - reinterpret_cast<uptr>(r.base) >= r.view_count * r.size)
+			continue;
+
+		const u32 page = static_cast<u32>(((addr - reinterpret_cast<uptr>(r.base)) % r.size) >> __pageshift);
+		if (!s_tracking)
+			ProtectPages(r, page, 1, true);
+		else if (!r.dirty[page])
+		{
+			r.dirty[page] = 1;
+			ProtectPages(r, page, 1, true);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+bool SaveStateDelta::IsWriteProtected(TrackedMemory id, u32 page)
+{
+	const Region& r = s_regions[id];
+	return s_tracking && r.base && page < r.page_count && !r.dirty[page];
+}
+
+void SaveStateDelta::ReprotectTracked(TrackedMemory id)
+{
+	Region& r = s_regions[id];
+	if (s_tracking && r.base)
+		ProtectRuns(r, 0, false);
+}
+
+void SaveStateDelta::StartTracking(void)
+{
+	// Everything starts out dirty, the first save copies it all and protects it.
+	for (Region& r : s_regions)
+	{
+		if (!r.base)
+			continue;
+		std::fill(r.dirty.begin(), r.dirty.end(), 1);
+		std::fill(r.since_key.begin(), r.since_key.end(), 1);
+		r.offset = NO_OFFSET;
+	}
+	s_tracking = true;
+}
+
+// Protects the pages copied by the save or fast load which just finished, memory matches
+// the scratch buffer on all of them now.
+void SaveStateDelta::CommitTracked(void)
+{
+	for (Region& r : s_regions)
+	{
+		if (!r.base)
+			continue;
+
+		if (!r.in_state)
+		{
+			// Not part of this state (the GS is frozen elsewhere), it has to be copied whole.
+			r.offset = NO_OFFSET;
+			continue;
+		}
+
+		ProtectRuns(r, 1, false);
+		std::fill(r.dirty.begin(), r.dirty.end(), 0);
+		r.in_state = false;
+	}
+}
+
+// The scratch buffer no longer holds the last state, the next save copies everything.
+void SaveStateDelta::InvalidateScratch(void)
+{
+	for (Region& r : s_regions)
+	{
+		r.offset = NO_OFFSET;
+		r.in_state = false;
+	}
+	s_scratch_size = 0;
+	s_last_serial = 0;
+}
+
+void SaveStateDelta::FreezeTracked(SaveStateBase& state, TrackedMemory id, void* data, size_t size)
+{
+	if (s_mode == Mode::None)
+	{
+		state.FreezeMem(data, static_cast<int>(size));
+		return;
+	}
+
+	state.PrepBlock(static_cast<int>(size));
+	if (!state.IsOkay())
+		return;
+
+	CopyTracked(id, data, state.GetBlockPtr(), size, state.IsLoading());
+	state.CommitBlock(static_cast<int>(size));
+}
+
+void SaveStateDelta::CopyTracked(TrackedMemory id, void* data, u8* state, size_t size, bool loading)
+{
+	Region& r = s_regions[id];
+	u8* mem = static_cast<u8*>(data);
+	if (s_mode == Mode::None || r.base != mem || r.size != size)
+	{
+		if (loading)
+			std::memcpy(mem, state, size);
+		else
+			std::memcpy(state, mem, size);
+		return;
+	}
+
+	const size_t offset = static_cast<size_t>(state - s_scratch.data());
+	r.in_state = true;
+	if (offset != r.offset)
+	{
+		// Moved within the state, or the scratch buffer doesn't hold it yet.
+		if (loading)
+			std::memcpy(mem, state, size);
+		else
+			std::memcpy(state, mem, size);
+		std::fill(r.since_key.begin(), r.since_key.end(), 1);
+		r.offset = offset;
+		s_stats.copied_pages += r.page_count;
+		return;
+	}
+
+	for (u32 page = 0; page < r.page_count; page++)
+	{
+		if (!r.dirty[page])
+			continue;
+
+		const size_t pos = static_cast<size_t>(page) << __pageshift;
+		if (loading)
+			std::memcpy(mem + pos, state + pos, __pagesize);
+		else
+			std::memcpy(state + pos, mem + pos, __pagesize);
+		if (s_mode == Mode::Save)
+			r.since_key[page] = 1;
+		s_stats.copied_pages++;
+	}
+}
+
+bool SaveStateDelta::SameLayout(const Keyframe& kf)
+{
+	for (u32 i = 0; i < TRACK_COUNT; i++)
+	{
+		if (kf.offsets[i] != s_regions[i].offset)
+			return false;
+	}
+	return true;
+}
+
+bool SaveStateDelta::PageChanged(u32 page, const Keyframe& kf)
+{
+	const size_t start = static_cast<size_t>(page) * DELTA_PAGE_SIZE;
+	const size_t end = start + DELTA_PAGE_SIZE;
+
+	// Pages entirely inside tracked memory changed if they were written since the keyframe.
+	for (const Region& r : s_regions)
+	{
+		if (!r.base || r.offset == NO_OFFSET || start < r.offset || end > r.offset + r.size)
+			continue;
+
+		const u32 first = static_cast<u32>((start - r.offset) >> __pageshift);
+		const u32 last = static_cast<u32>((end - 1 - r.offset) >> __pageshift);
+		for (u32 i = first; i <= last; i++)
+		{
+			if (r.since_key[i])
+				return true;
+		}
+		return false;
+	}
+
+	return std::memcmp(s_scratch.data() + start, kf.data.data() + start, DELTA_PAGE_SIZE) != 0;
+}
+
+void SaveStateDelta::StartKeyframe(size_t state_size)
+{
+	// The rewind ring makes room by evicting the oldest keyframes, the deltas made
+	// against them stop loading, which is where rewinding ends.
+	if (s_rewind_budget != 0)
+	{
+		while (!s_keyframes.empty() && s_keyframe_bytes + PageAlign(state_size) > s_rewind_budget)
+		{
+			DropOldestKeyframe();
+			s_stats.evicted_keyframes++;
+		}
+	}
+
+	Keyframe kf;
+	kf.id = s_next_keyframe_id++;
+	kf.state_size = state_size;
+	for (u32 i = 0; i < TRACK_COUNT; i++)
+		kf.offsets[i] = s_regions[i].offset;
+
+	kf.data.swap(s_spare);
+	kf.data.resize(PageAlign(state_size));
+	std::memcpy(kf.data.data(), s_scratch.data(), kf.data.size());
+	s_keyframe_bytes += kf.data.size();
+	s_keyframes.push_back(std::move(kf));
+
+	for (Region& r : s_regions)
+		std::fill(r.since_key.begin(), r.since_key.end(), 0);
+	s_stats.keyframes++;
+}
+
+void SaveStateDelta::DropOldestKeyframe(void)
+{
+	s_keyframe_bytes -= s_keyframes.front().data.size();
+	if (s_spare.empty())
+		s_spare.swap(s_keyframes.front().data);
+	s_keyframes.pop_front();
+}
+
+// A state made against keyframe id was loaded, so the ones before it aren't needed by
+// anything the frontend will load from here on. Not true when rewinding, the frontend
+// goes on to load older states.
+void SaveStateDelta::ReleaseKeyframes(u64 id)
+{
+	if (s_rewind_budget != 0)
+		return;
+
+	while (id != 0 && !s_keyframes.empty() && s_keyframes.front().id < id)
+		DropOldestKeyframe();
+}
+
+SaveStateDelta::Keyframe* SaveStateDelta::FindKeyframe(u64 id)
+{
+	for (Keyframe& kf : s_keyframes)
+	{
+		if (kf.id == id)
+			return &kf;
+	}
+	return nullptr;
+}
+
+bool SaveStateDelta::Save(bool (*freeze)(SaveStateBase&), void* out, size_t out_size, size_t* written)
+{
+	if (out_size < sizeof(Header))
+		return false;
+
+	if (s_session == 0)
+		s_session = Common::Timer::GetCurrentValue() | 1;
+	if (!s_tracking)
+		StartTracking();
+
+	const size_t aligned = PageAlign(out_size);
+	if (s_scratch.size() != aligned)
+	{
+		s_scratch.resize(aligned);
+		InvalidateScratch();
+	}
+
+	s_mode = Mode::Save;
+	memSpanSavingState saveme(s_scratch.data(), out_size);
+	const bool okay = freeze(saveme);
+	s_mode = Mode::None;
+
+	if (!okay)
+	{
+		InvalidateScratch();
+		return false;
+	}
+
+	CommitTracked();
+	s_scratch_size = saveme.GetSize();
+	return Encode(out, out_size, written);
+}
+
+bool SaveStateDelta::Encode(void* out, size_t out_size, size_t* written)
+{
+	// Garbage past the end of the state would otherwise show up as changed pages.
+	const size_t state_size = s_scratch_size;
+	const size_t aligned_size = PageAlign(state_size);
+	std::memset(s_scratch.data() + state_size, 0, aligned_size - state_size);
+	const u32 page_total = static_cast<u32>(aligned_size / DELTA_PAGE_SIZE);
+
+	const Keyframe* kf = s_keyframes.empty() ? nullptr : &s_keyframes.back();
+	bool rekey = !kf || kf->state_size != state_size || !SameLayout(*kf);
+
+	s_changed_pages.clear();
+	if (!rekey)
+	{
+		const u32 rekey_threshold = page_total / REKEY_DIVISOR;
+		for (u32 page = 0; page < page_total; page++)
+		{
+			if (!PageChanged(page, *kf))
+				continue;
+
+			s_changed_pages.push_back(page);
+			if (s_changed_pages.size() > rekey_threshold)
+			{
+				rekey = true;
+				break;
+			}
+		}
+
+		const size_t needed = sizeof(Header) + s_changed_pages.size() * (sizeof(u32) + DELTA_PAGE_SIZE);
+		rekey = rekey || needed > out_size;
+	}
+
+	Header header;
+	header.magic = MAGIC;
+	header.version = VERSION;
+	header.session = s_session;
+	header.serial = s_next_serial++;
+	header.state_size = static_cast<u32>(state_size);
+
+	u8* ptr = static_cast<u8*>(out);
+	if (rekey)
+	{
+		// Written out whole, so loading it never needs a keyframe. Older keyframes stay
+		// until this or a later state is loaded; while too many are held, this one
+		// doesn't become a keyframe at all.
+		if (sizeof(Header) + state_size > out_size)
+			return false;
+
+		if (s_rewind_budget != 0 || s_keyframes.size() < KEYFRAME_LIMIT)
+		{
+			StartKeyframe(state_size);
+			header.keyframe_id = s_keyframes.back().id;
+		}
+		else
+		{
+			header.keyframe_id = 0;
+			s_stats.full_states++;
+		}
+		header.flags = FLAG_FULL;
+		header.page_count = 0;
+
+		std::memcpy(ptr, &header, sizeof(header));
+		ptr += sizeof(header);
+		std::memcpy(ptr, s_scratch.data(), state_size);
+		ptr += state_size;
+	}
+	else
+	{
+		header.keyframe_id = kf->id;
+		header.flags = 0;
+		header.page_count = static_cast<u32>(s_changed_pages.size());
+
+		std::memcpy(ptr, &header, sizeof(header));
+		ptr += sizeof(header);
+		if (!s_changed_pages.empty())
+		{
+			std::memcpy(ptr, s_changed_pages.data(), s_changed_pages.size() * sizeof(u32));
+			ptr += s_changed_pages.size() * sizeof(u32);
+		}
+		for (const u32 page : s_changed_pages)
+		{
+			std::memcpy(ptr, s_scratch.data() + static_cast<size_t>(page) * DELTA_PAGE_SIZE, DELTA_PAGE_SIZE);
+			ptr += DELTA_PAGE_SIZE;
+		}
+
+		s_stats.deltas++;
+		s_stats.changed_pages += s_changed_pages.size();
+		s_stats.delta_bytes += static_cast<size_t>(ptr - static_cast<u8*>(out));
+	}
+
+	*written = static_cast<size_t>(ptr - static_cast<u8*>(out));
+	s_last_serial = header.serial;
+	return true;
+}
+
+bool SaveStateDelta::IsDelta(const void* data, size_t size)
+{
+	u32 magic;
+	if (size < sizeof(Header))
+		return false;
+	std::memcpy(&magic, data, sizeof(magic));
+	return magic == MAGIC;
+}
+
+// Rebuilds the state in the scratch buffer.
+bool SaveStateDelta::Rebuild(const Header& header, const u8* payload, size_t payload_size)
+{
+	const size_t aligned_size = PageAlign(header.state_size);
+	if (s_scratch.size() < aligned_size)
+		s_scratch.resize(aligned_size);
+
+	if (header.flags & FLAG_FULL)
+	{
+		if (payload_size < header.state_size)
+			return false;
+		std::memcpy(s_scratch.data(), payload, header.state_size);
+		s_scratch_size = header.state_size;
+		return true;
+	}
+
+	const Keyframe* kf = FindKeyframe(header.keyframe_id);
+	if (!kf || kf->state_size != header.state_size)
+	{
+		Console.Error("(SaveStateDelta) Keyframe %llu for delta state is no longer available",
+			static_cast<unsigned long long>(header.keyframe_id));
+		return false;
+	}
+
+	const size_t page_total = aligned_size / DELTA_PAGE_SIZE;
+	const size_t needed = static_cast<size_t>(header.page_count) * (sizeof(u32) + DELTA_PAGE_SIZE);
+	if (header.page_count > page_total || payload_size < needed)
+		return false;
+
+	const u8* indices = payload;
+	const u8* pages = indices + static_cast<size_t>(header.page_count) * sizeof(u32);
+
+	u8* dst = s_scratch.data();
+	std::memcpy(dst, kf->data.data(), aligned_size);
+	for (u32 i = 0; i < header.page_count; i++)
+	{
+		u32 page;
+		std::memcpy(&page, indices + i * sizeof(u32), sizeof(page));
+		if (page >= page_total)
+			return false;
+
+		std::memcpy(dst + static_cast<size_t>(page) * DELTA_PAGE_SIZE, pages + static_cast<size_t>(i) * DELTA_PAGE_SIZE, DELTA_PAGE_SIZE);
+	}
+
+	s_scratch_size = header.state_size;
+	return true;
+}
+
+bool SaveStateDelta::Load(const void* data, size_t size, bool (*freeze)(SaveStateBase&))
+{
+	Header header;
+	if (size < sizeof(Header))
+		return false;
+	std::memcpy(&header, data, sizeof(header));
+
+	if (header.magic != MAGIC || header.version != VERSION)
+		return false;
+
+	if (header.session != s_session)
+	{
+		Console.Error("(SaveStateDelta) Delta state belongs to another session");
+		return false;
+	}
+
+	// The last state saved is still in the scratch buffer, and tracked memory only
+	// differs from it where it's been written since.
+	const bool fast = (s_tracking && header.serial == s_last_serial && s_scratch_size == header.state_size);
+	if (!fast)
+	{
+		InvalidateScratch();
+		if (!Rebuild(header, static_cast<const u8*>(data) + sizeof(Header), size - sizeof(Header)))
+		{
+			s_scratch_size = 0;
+			return false;
+		}
+	}
+
+	ReleaseKeyframes(header.keyframe_id);
+
+	s_mode = fast ? Mode::FastLoad : Mode::None;
+	memSpanLoadingState loadme(s_scratch.data(), s_scratch_size);
+	const bool okay = freeze(loadme);
+	s_mode = Mode::None;
+
+	if (fast)
+	{
+		// Pages a failed load didn't get to are still dirty, so they're copied next time.
+		if (okay)
+			CommitTracked();
+		s_stats.fast_loads++;
+	}
+	else
+	{
+		// Loading wrote (and dirtied) all of tracked memory, but nothing knows where the
+		// scratch buffer holds it.
+		InvalidateScratch();
+	}
+
+	return okay;
+}
+
+void SaveStateDelta::Reset(void)
+{
+	if (s_stats.deltas > 0)
+	{
+		const u64 saves = s_stats.deltas + s_stats.keyframes + s_stats.full_states;
+		Console.WriteLn("(SaveStateDelta) %llu keyframes (%llu evicted by the rewind ring), %llu full states, %llu deltas, "
+						"%llu KB per delta on average, %llu tracked pages copied per save or load, %llu fast loads",
+			static_cast<unsigned long long>(s_stats.keyframes), static_cast<unsigned long long>(s_stats.evicted_keyframes),
+			static_cast<unsigned long long>(s_stats.full_states),
+			static_cast<unsigned long long>(s_stats.deltas),
+			static_cast<unsigned long long>((s_stats.delta_bytes / s_stats.deltas) / 1024),
+			static_cast<unsigned long long>(s_stats.copied_pages / (saves + s_stats.fast_loads)),
+			static_cast<unsigned long long>(s_stats.fast_loads));
+	}
+
+	if (s_tracking)
+	{
+		for (Region& r : s_regions)
+		{
+			if (r.base)
+				ProtectRuns(r, 0, true);
+		}
+		s_tracking = false;
+	}
+	InvalidateScratch();
+
+	s_keyframes = {};
+	s_keyframe_bytes = 0;
+	s_spare = {};
+	s_scratch = {};
+	s_changed_pages = {};
+	s_next_serial = 1;
+	s_session = 0;
+	s_stats = {};
+}
+
+void SaveStateDelta::SetRewindBudget(size_t bytes)
+{
+	s_rewind_budget = bytes;
+}
+
+const SaveStateDelta::Stats& SaveStateDelta::GetStats(void)
+{
+	return s_stats;
+}
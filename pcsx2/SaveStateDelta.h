@@ -0,0 +1,119 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../common/Pcsx2Defs.h"
+
+class SaveStateBase;
+
+// --------------------------------------------------------------------------------------
+//  SaveStateDelta
+// --------------------------------------------------------------------------------------
+// Delta savestates for run-ahead and rewind. Only the pages which differ from an in-memory keyframe
+// are written out, so deltas are only meaningful to the process which made them.
+//
+// The large memories (EE RAM, IOP RAM, GS local memory) are write protected once they've
+// been saved, and the page fault handler marks the pages written since. A save then only
+// copies those pages into the state kept from the last save, and loading back the last
+// state only copies them back. Everything else in the state is small enough to compare
+// against the keyframe.
+//
+// A new keyframe is written out as a full state, so it never needs an older keyframe.
+// For run-ahead, keyframes are dropped once a state made against a newer one has been
+// loaded; if too many are still held, full states are written instead of starting another.
+// Rewinding loads older and older states, so there the keyframes are kept in a ring
+// bounded by a memory budget, and the oldest is evicted to make room for a new one.
+
+namespace SaveStateDelta
+{
+	static constexpr u32 DELTA_PAGE_SIZE = 4096;
+
+	/// Room to leave in the savestate size for the header of a full state.
+	static constexpr size_t HEADER_RESERVE = 64;
+
+	enum TrackedMemory : u32
+	{
+		TRACK_EE_RAM,
+		TRACK_IOP_RAM,
+		TRACK_GS_MEM,
+		TRACK_COUNT
+	};
+
+	/// Changes the protection of a run of host pages of tracked memory. Memory which has
+	/// to keep pages protected for its own reasons (EE RAM holding recompiled code) passes
+	/// one to RegisterTracked(), the default protects every view.
+	using ProtectFn = void (*)(u32 first_page, u32 page_count, bool writable);
+
+	struct Stats
+	{
+		u64 keyframes;
+		u64 evicted_keyframes; // dropped by the rewind ring to stay within its budget
+		u64 full_states;   // written because too many keyframes were still held
+		u64 deltas;
+		u64 delta_bytes;   // total bytes written for deltas, headers included
+		u64 changed_pages; // total pages written for deltas
+		u64 copied_pages;  // tracked pages copied by saves and fast loads
+		u64 fast_loads;
+	};
+
+	/// Makes memory available for write tracking. view_count views of size bytes each
+	/// follow each other from base, all mapping the same memory.
+	void RegisterTracked(TrackedMemory id, u8* base, u32 view_count, size_t size, ProtectFn protect);
+	void UnregisterTracked(TrackedMemory id);
+
+	/// Called by the page fault handler for a write to tracked memory. Returns false if
+	/// the page wasn't protected for tracking, which leaves making it writable to the caller.
+	bool TrackWrite(TrackedMemory id, u32 page);
+
+	/// Handles a write fault at a host address in any view of tracked memory.
+	/// Returns false if addr isn't tracked memory.
+	bool HandleWriteFault(uptr addr);
+
+	/// Returns true if the page is protected to catch the next write to it.
+	bool IsWriteProtected(TrackedMemory id, u32 page);
+
+	/// Protects the clean pages again after something made the whole region writable.
+	void ReprotectTracked(TrackedMemory id);
+
+	/// Freezes tracked memory. Inside Save() or a fast Load() only the pages written since
+	/// the last state are copied, otherwise it's the same as FreezeMem().
+	void FreezeTracked(SaveStateBase& state, TrackedMemory id, void* data, size_t size);
+
+	/// The same for savestate code which works on a raw buffer (the GS).
+	void CopyTracked(TrackedMemory id, void* data, u8* state, size_t size, bool loading);
+
+	/// Freezes the machine with freeze and writes it to out as a delta, or as a full
+	/// state when a new keyframe is started. Returns false if the state didn't fit.
+	bool Save(bool (*freeze)(SaveStateBase&), void* out, size_t out_size, size_t* written);
+
+	/// Returns true if data holds a state written by Save() rather than a plain state.
+	bool IsDelta(const void* data, size_t size);
+
+	/// Loads a state written by Save() with freeze. Loading the last state saved only
+	/// copies back what was written since. Fails if the state was made in another
+	/// session or its keyframe has been dropped.
+	bool Load(const void* data, size_t size, bool (*freeze)(SaveStateBase&));
+
+	/// Keeps keyframes for rewinding in a ring of up to bytes, or releases them as soon as
+	/// run-ahead is done with them if bytes is 0. Takes effect with the next keyframe.
+	void SetRewindBudget(size_t bytes);
+
+	/// Drops all keyframes, stops write tracking and starts a new session, call when the
+	/// game changes.
+	void Reset(void);
+
+	const Stats& GetStats(void);
+} // namespace SaveStateDelta
@@ -16,6 +16,7 @@
 #include "VMManager.h"
 
 #include <atomic>
+#include <condition_variable>
 #include <sstream>
 #include <mutex>
 
@@ -40,6 +41,7 @@
 #include "GS/Renderers/HW/GSTextureReplacements.h"
 #include "Host.h"
 #include "IopBios.h"
+#include "IPU/IPU_Thread.h"
 #include "MTVU.h"
 #include "MemoryCardFile.h"
 #include "Patch.h"
@@ -122,6 +124,7 @@ namespace VMManager
 	static void LoadPatches(const std::string& serial, u32 crc);
 	static void UpdateRunningGame(bool resetting, bool game_starting, bool swapping_disc);
 
+	static void StoreState(VMState state);
 	static void SetTimerResolutionIncreased(bool enabled);
 	static void SetHardwareDependentDefaultSettings(SettingsInterface& si);
 	static void EnsureCPUInfoInitialized();
@@ -131,6 +134,8 @@ namespace VMManager
 static std::unique_ptr<SysMainMemory> s_vm_memory;
 
 static std::atomic<VMState> s_state{VMState::Shutdown};
+static std::mutex s_state_mutex;
+static std::condition_variable s_state_cv;
 static bool s_cpu_implementation_changed = false;
 static Threading::ThreadHandle s_vm_thread_handle;
 
@@ -153,12 +158,31 @@ VMState VMManager::GetState()
 	return s_state.load(std::memory_order_acquire);
 }
 
+void VMManager::StoreState(VMState state)
+{
+	// Store under the lock, otherwise the change could land between a waiter's check and its wait.
+	{
+		std::unique_lock lock(s_state_mutex);
+		s_state.store(state, std::memory_order_release);
+	}
+	s_state_cv.notify_all();
+}
+
+void VMManager::WaitWhileState(VMState state)
+{
+	if (s_state.load(std::memory_order_acquire) != state)
+		return;
+
+	std::unique_lock lock(s_state_mutex);
+	s_state_cv.wait(lock, [state]() { return s_state.load(std::memory_order_acquire) != state; });
+}
+
 void VMManager::SetState(VMState state)
 {
 	// Some state transitions aren't valid.
 	const VMState old_state = s_state.load(std::memory_order_acquire);
 	SetTimerResolutionIncreased(state == VMState::Running);
-	s_state.store(state, std::memory_order_release);
+	StoreState(state);
 
 	if (state != VMState::Stopping && (state == VMState::Paused || old_state == VMState::Paused))
 	{
@@ -468,6 +492,7 @@ void VMManager::UpdateRunningGame(bool resetting, bool game_starting, bool swapp
 	}
 
 	MTGS::GameChanged();
+	mVUdiskCacheSetGame(s_game_serial);
 	Host::OnGameChanged(s_disc_path, s_elf_override, s_game_serial, s_game_crc);
 }
 
@@ -551,13 +576,13 @@ bool VMManager::ApplyBootParameters(VMBootParameters params, std::string* state_
 bool VMManager::Initialize(VMBootParameters boot_params)
 {
 	std::string state_to_load;
-	s_state.store(VMState::Initializing, std::memory_order_release);
+	StoreState(VMState::Initializing);
 	s_vm_thread_handle = Threading::ThreadHandle::GetForCallingThread();
 
 	if (!ApplyBootParameters(std::move(boot_params), &state_to_load))
 	{
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -565,7 +590,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 	if (!IsBIOSAvailable(EmuConfig.FullpathToBios()))
 	{
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -574,7 +599,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 	if (!DoCDVDopen())
 	{
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -586,7 +611,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 		DoCDVDclose();
 		CDVDsys_ClearFiles();
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -598,7 +623,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 		DoCDVDclose();
 		CDVDsys_ClearFiles();
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -612,7 +637,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 		DoCDVDclose();
 		CDVDsys_ClearFiles();
 		s_vm_thread_handle = {};
-		s_state.store(VMState::Shutdown, std::memory_order_release);
+		StoreState(VMState::Shutdown);
 		return false;
 	}
 
@@ -630,7 +655,7 @@ bool VMManager::Initialize(VMBootParameters boot_params)
 	cpuReset();
 	hwReset();
 
-	s_state.store(VMState::Paused, std::memory_order_release);
+	StoreState(VMState::Paused);
 
 	UpdateRunningGame(true, false, false);
 
@@ -645,7 +670,7 @@ void VMManager::Shutdown()
 {
 	// we'll probably already be stopping (this is how Qt calls shutdown),
 	// but just in case, so any of the stuff we call here knows we don't have a valid VM.
-	s_state.store(VMState::Stopping, std::memory_order_release);
+	StoreState(VMState::Stopping);
 
 	SetTimerResolutionIncreased(false);
 
@@ -686,6 +711,7 @@ void VMManager::Shutdown()
 	SPU2::Close();
 	PADclose();
 	DEV9close();
+	ipuThread.Close();
 
 	cdvdSaveNVRAM();
 
@@ -699,7 +725,7 @@ void VMManager::Shutdown()
 	PADshutdown();
 	DEV9shutdown();
 
-	s_state.store(VMState::Shutdown, std::memory_order_release);
+	StoreState(VMState::Shutdown);
 
 	// clear out any potentially-incorrect settings from the last game
 	LoadSettings();
@@ -714,7 +740,7 @@ void VMManager::Reset()
 	// since the rec won't be running, so it's safe to immediately reset there.
 	if (s_state.load(std::memory_order_acquire) == VMState::Running)
 	{
-		s_state.store(VMState::Resetting, std::memory_order_release);
+		StoreState(VMState::Resetting);
 		return;
 	}
 
@@ -741,7 +767,7 @@ void VMManager::Reset()
 
 	// If we were paused, state won't be resetting, so don't flip back to running.
 	if (s_state.load(std::memory_order_acquire) == VMState::Resetting)
-		s_state.store(VMState::Running, std::memory_order_release);
+		StoreState(VMState::Running);
 }
 
 bool VMManager::ChangeDisc(CDVD_SourceType source, std::string path)
@@ -784,8 +810,6 @@ void VMManager::InitializeCPUProviders()
 	dVifReserve(1);
 
 	GSCodeReserve::GetInstance().Assign(GetVmMemory().CodeMemory());
-
-	VifUnpackSSE_Init();
 }
 
 void VMManager::ShutdownCPUProviders()
@@ -795,8 +819,6 @@ void VMManager::ShutdownCPUProviders()
 	dVifRelease(1);
 	dVifRelease(0);
 
-	VifUnpackSSE_Destroy();
-
 	CpuMicroVU1.Shutdown();
 	CpuMicroVU0.Shutdown();
 
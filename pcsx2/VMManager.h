@@ -54,6 +54,9 @@ namespace VMManager
 	/// Alters the current state of the VM.
 	void SetState(VMState state);
 
+	/// Blocks the calling thread for as long as the VM stays in the given state.
+	void WaitWhileState(VMState state);
+
 	/// Returns true if there is an active virtual machine.
 	bool HasValidVM();
 
@@ -151,6 +151,13 @@ extern recMicroVU1 CpuMicroVU1;
 extern BaseVUmicroCPU* CpuVU0;
 extern BaseVUmicroCPU* CpuVU1;
 
+// Tells the microVU program cache which game is running (VM thread).
+extern void mVUdiskCacheSetGame(const std::string& serial);
+// Precompiles saved microVU entry points while the VUs aren't running, between frames on
+// the VM thread, and with MTVU while its ring is empty (VU1 only).
+extern void mVUdiskCacheWarmFrame();
+extern bool mVUdiskCacheWarmIdle(u32 vuIndex, u32 maxEntries);
+
 
 // VU0
 extern void vu0ResetRegs();
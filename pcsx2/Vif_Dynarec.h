@@ -23,18 +23,29 @@
 #include "Vif_HashBucket.h"
 #include "VU.h"
 
-typedef u32  (*nVifCall)(void*, const void*);
 typedef void (*nVifrecCall)(uptr dest, uptr src);
 
 extern void _nVifUnpack  (int idx, const u8* data, uint mode, bool isFill);
 extern void  dVifReserve (int idx);
 extern void  dVifReset   (int idx);
 extern void  dVifRelease (int idx);
-extern void  VifUnpackSSE_Init();
-extern void  VifUnpackSSE_Destroy();
 
 _vifT extern void dVifUnpack(const u8* data, bool isFill);
 
+// Block cache counters for one VIF unit, since the last reset.
+struct nVifStats
+{
+	u64 lookups;   // unpacks which went through the dynarec
+	u64 compiles;  // unpacks which had to compile a new block
+	u64 probes;    // extra buckets visited during lookups
+	u32 maxProbe;  // longest probe sequence seen
+	u32 blocks;    // blocks currently cached
+	u32 buckets;   // current size of the block table
+	u64 codeBytes; // size of the generated code
+};
+
+extern nVifStats dVifGetStats(int idx, bool reset = false);
+
 struct nVifStruct
 {
 	// Buffer for partial transfers (should always be first to ensure alignment)
@@ -50,6 +61,7 @@ struct nVifStruct
 	u8*                     recWritePtr; // current write pos into the reserve
 
 	HashBucket              vifBlocks;   // Vif Blocks
+	u64                     codeBytes;   // code generated since the last reset
 
 
 	nVifStruct() = default;
@@ -58,5 +70,3 @@ struct nVifStruct
 extern void resetNewVif(int idx);
 
 alignas(16) extern nVifStruct nVif[2];
-alignas(16) extern nVifCall nVifUpk[(2 * 2 * 16) * 4]; // ([USN][Masking][Unpack Type]) [curCycle]
-alignas(16) extern u32      nVifMask[3][4][4];         // [MaskNumber][CycleNumber][Vector]
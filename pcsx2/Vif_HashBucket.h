@@ -17,8 +17,8 @@
 
 #include "../common/AlignedMalloc.h"
 
-// nVifBlock - Ordered for Hashing; the 'num' and 'upkType' fields are
-//             used as the hash bucket selector.
+// nVifBlock - Ordered for Hashing; hash_key, key0 and key1 together
+//             identify a block in the HashBucket.
 union nVifBlock
 {
 	// Warning: order depends on the newVifDynaRec code
@@ -46,96 +46,192 @@ union nVifBlock
 
 }; // 16 bytes
 
-// 0x4000 is enough but 0x10000 allow
-// * to skip the compare value of the first double world in lookup
-// * to use a 16 bits move instead of an 'and' mask to compute the hashed key
-#define HSIZE 0x10000 // [usn*1:mask*1:upk*4:num*8] hash...
-
-// HashBucket is a container which uses a built-in hash function
-// to perform quick searches. It is designed around the nVifBlock structure
+// HashBucket is an open addressing hash table of recompiled unpack blocks.
 //
-// The hash function is determined by taking the first bytes of data and
-// performing a modulus the size of HSIZE. So the most diverse-data should
-// be in the first bytes of the struct. (hence why nVifBlock is specifically sorted)
+// Each bucket is one cache line holding the keys, length and code pointer of
+// up to BUCKET_SLOTS blocks, so a lookup that hits touches a single line
+// instead of following a pointer into a separately allocated chain. Buckets
+// are probed linearly, and the table doubles once it is three quarters full
+// so there is always an empty slot to end a probe.
 class HashBucket
 {
+public:
+	struct Stats
+	{
+		u64 lookups;  // blocks looked up
+		u64 misses;   // lookups that found nothing (i.e. compiles)
+		u64 probes;   // buckets visited past the first one, over all lookups
+		u32 maxProbe; // longest probe sequence seen
+		u32 blocks;   // blocks in the table
+		u32 buckets;  // size of the table
+	};
+
 protected:
-	nVifBlock* m_bucket[HSIZE];
+	static constexpr u32 BUCKET_SLOTS = (sizeof(uptr) == 8) ? 3 : 4;
+	static constexpr u32 INITIAL_BUCKETS = 256;
 
-public:
-	HashBucket()
+	struct alignas(64) Bucket
 	{
-		int i;
-		for (i = 0; i < HSIZE; i++)
-			m_bucket[i] = nullptr;
-	}
+		u32 key0[BUCKET_SLOTS];
+		u32 key1[BUCKET_SLOTS];
+		u16 hash_key[BUCKET_SLOTS];
+		u16 length[BUCKET_SLOTS];
+		uptr startPtr[BUCKET_SLOTS]; // 0 marks an empty slot
+	};
+	static_assert(sizeof(Bucket) == 64, "Bucket should fill a cache line");
 
-	~HashBucket() { clear(); }
+	Bucket* m_buckets = nullptr;
+	u32 m_mask = 0;
+	u32 m_blocks = 0;
 
-	__fi nVifBlock* find(const nVifBlock& dataPtr)
+	u64 m_lookups = 0;
+	u64 m_misses = 0;
+	u64 m_probes = 0;
+	u32 m_maxProbe = 0;
+
+	static __fi u32 hash(const nVifBlock& dataPtr)
 	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
-		for (;;)
-		{
-			if (chainpos->key0 == dataPtr.key0 && chainpos->key1 == dataPtr.key1)
-				return chainpos;
+		u32 h = dataPtr.hash_key * 0x9E3779B1u;
+		h ^= dataPtr.key0 * 0x85EBCA77u;
+		h ^= dataPtr.key1 * 0xC2B2AE3Du;
+		return h ^ (h >> 15);
+	}
 
-			if (chainpos->startPtr == 0)
-				return nullptr;
+	__fi void countProbe(u32 probe)
+	{
+		m_probes += probe;
+		if (probe > m_maxProbe)
+			m_maxProbe = probe;
+	}
 
-			chainpos++;
+	void insert(const nVifBlock& dataPtr)
+	{
+		for (u32 b = hash(dataPtr) & m_mask;; b = (b + 1) & m_mask)
+		{
+			Bucket& bucket = m_buckets[b];
+			for (u32 i = 0; i < BUCKET_SLOTS; i++)
+			{
+				if (bucket.startPtr[i] != 0)
+					continue;
+
+				bucket.key0[i] = dataPtr.key0;
+				bucket.key1[i] = dataPtr.key1;
+				bucket.hash_key[i] = dataPtr.hash_key;
+				bucket.length[i] = dataPtr.length;
+				bucket.startPtr[i] = dataPtr.startPtr;
+				return;
+			}
 		}
 	}
 
-	void add(const nVifBlock& dataPtr)
+	void allocate(u32 buckets)
 	{
-		u32 b = dataPtr.hash_key;
+		m_buckets = (Bucket*)_aligned_malloc(sizeof(Bucket) * buckets, 64);
+		memset(m_buckets, 0, sizeof(Bucket) * buckets);
+		m_mask = buckets - 1;
+	}
 
-		u32 size = bucket_size(dataPtr);
+	void grow()
+	{
+		Bucket* old = m_buckets;
+		const u32 oldCount = m_mask + 1;
+		allocate(oldCount * 2);
 
-		// Warning there is an extra +1 due to the empty cell
-		// Performance note: 64B align to reduce cache miss penalty in `find`
-		m_bucket[b] = (nVifBlock*)pcsx2_aligned_realloc(m_bucket[b], sizeof(nVifBlock) * (size + 2), 64, sizeof(nVifBlock) * (size + 1));
-		// Replace the empty cell by the new block and create a new empty cell
-		memcpy(&m_bucket[b][size++], &dataPtr, sizeof(nVifBlock));
-		memset(&m_bucket[b][size], 0, sizeof(nVifBlock));
+		nVifBlock block;
+		for (u32 b = 0; b < oldCount; b++)
+		{
+			for (u32 i = 0; i < BUCKET_SLOTS; i++)
+			{
+				if (old[b].startPtr[i] == 0)
+					continue;
+
+				block.hash_key = old[b].hash_key[i];
+				block.length = old[b].length[i];
+				block.key0 = old[b].key0[i];
+				block.key1 = old[b].key1[i];
+				block.startPtr = old[b].startPtr[i];
+				insert(block);
+			}
+		}
+
+		safe_aligned_free(old);
 	}
 
-	u32 bucket_size(const nVifBlock& dataPtr)
-	{
-		nVifBlock* chainpos = m_bucket[dataPtr.hash_key];
+public:
+	HashBucket() = default;
+	~HashBucket() { clear(); }
 
-		u32 size = 0;
+	// Fills in length and startPtr of dataPtr if a block with the same keys
+	// has been added, returns false otherwise.
+	__fi bool find(nVifBlock& dataPtr)
+	{
+		m_lookups++;
 
-		while (chainpos->startPtr != 0)
+		u32 b = hash(dataPtr) & m_mask;
+		for (u32 probe = 0;; probe++, b = (b + 1) & m_mask)
 		{
-			size++;
-			chainpos++;
+			const Bucket& bucket = m_buckets[b];
+			for (u32 i = 0; i < BUCKET_SLOTS; i++)
+			{
+				if (bucket.startPtr[i] == 0)
+				{
+					m_misses++;
+					countProbe(probe);
+					return false;
+				}
+
+				if (bucket.key0[i] == dataPtr.key0 && bucket.key1[i] == dataPtr.key1 && bucket.hash_key[i] == dataPtr.hash_key)
+				{
+					if (unlikely(probe != 0))
+						countProbe(probe);
+					dataPtr.length = bucket.length[i];
+					dataPtr.startPtr = bucket.startPtr[i];
+					return true;
+				}
+			}
 		}
+	}
+
+	void add(const nVifBlock& dataPtr)
+	{
+		if ((m_blocks + 1) * 4 > (m_mask + 1) * BUCKET_SLOTS * 3)
+			grow();
+
+		insert(dataPtr);
+		m_blocks++;
+	}
 
-		return size;
+	Stats getStats() const
+	{
+		Stats stats;
+		stats.lookups = m_lookups;
+		stats.misses = m_misses;
+		stats.probes = m_probes;
+		stats.maxProbe = m_maxProbe;
+		stats.blocks = m_blocks;
+		stats.buckets = m_buckets ? (m_mask + 1) : 0;
+		return stats;
+	}
+
+	void resetStats()
+	{
+		m_lookups = 0;
+		m_misses = 0;
+		m_probes = 0;
+		m_maxProbe = 0;
 	}
 
 	void clear()
 	{
-		int i;
-		for (i = 0; i < HSIZE; i++)
-		{
-			if (m_bucket[i])
-				safe_aligned_free(m_bucket[i]);
-		}
+		safe_aligned_free(m_buckets);
+		m_mask = 0;
+		m_blocks = 0;
 	}
 
 	void reset()
 	{
-		int i;
 		clear();
-
-		// Allocate an empty cell for all buckets
-		for (i = 0; i < HSIZE; i++)
-		{
-			m_bucket[i] = (nVifBlock*)_aligned_malloc(sizeof(nVifBlock), 16);
-			memset(m_bucket[i], 0, sizeof(nVifBlock));
-		}
+		resetStats();
+		allocate(INITIAL_BUCKETS);
 	}
 };
@@ -20,170 +20,7 @@
 #include "Vif_Dma.h"
 #include "Vif_Dynarec.h"
 #include "MTVU.h"
-
-enum UnpackOffset {
-	OFFSET_X = 0,
-	OFFSET_Y = 1,
-	OFFSET_Z = 2,
-	OFFSET_W = 3
-};
-
-static __fi u32 setVifRow(vifStruct& vif, u32 reg, u32 data) {
-	vif.MaskRow._u32[reg] = data;
-	return data;
-}
-
-// cycle derives from vif.cl
-// mode derives from vifRegs.mode
-template< uint idx, uint mode, bool doMask >
-static __ri void writeXYZW(u32 offnum, u32 &dest, u32 data) {
-	int n = 0;
-
-	vifStruct& vif = MTVU_VifX;
-
-	if (doMask) {
-		const VIFregisters& regs = MTVU_VifXRegs;
-		switch (vif.cl) {
-			case 0:  n = (regs.mask >> (offnum * 2)) & 0x3;		break;
-			case 1:  n = (regs.mask >> ( 8 + (offnum * 2))) & 0x3;	break;
-			case 2:  n = (regs.mask >> (16 + (offnum * 2))) & 0x3;	break;
-			default: n = (regs.mask >> (24 + (offnum * 2))) & 0x3;	break;
-		}
-	}
-
-	// Four possible types of masking are handled below:
-	//   0 - Data
-	//   1 - MaskRow
-	//   2 - MaskCol
-	//   3 - Write protect
-
-	switch (n) {
-		case 0:
-			switch (mode) {
-				case 1:  dest = data + vif.MaskRow._u32[offnum]; break;
-				case 2:  dest = setVifRow(vif, offnum, vif.MaskRow._u32[offnum] + data); break;
-				case 3:  dest = setVifRow(vif, offnum, data); break;
-				default: dest = data; break;
-			}
-			break;
-		case 1: dest = vif.MaskRow._u32[offnum]; break;
-		case 2: dest = vif.MaskCol._u32[std::min(vif.cl,3)]; break;
-		case 3: break;
-	}
-}
-#define tParam idx,mode,doMask
-
-template < uint idx, uint mode, bool doMask, class T >
-static void UNPACK_S(u32* dest, const T* src)
-{
-	u32 data = *src;
-
-	//S-# will always be a complete packet, no matter what. So we can skip the offset bits
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), data);
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), data);
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), data);
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), data);
-}
-
-// The PS2 console actually writes v1v0v1v0 for all V2 unpacks -- the second v1v0 pair
-// being officially "indeterminate" but some games very much depend on it.
-template < uint idx, uint mode, bool doMask, class T >
-static void UNPACK_V2(u32* dest, const T* src)
-{
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+0));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+1));
-}
-
-// V3 and V4 unpacks both use the V4 unpack logic, even though most of the OFFSET_W fields
-// during V3 unpacking end up being overwritten by the next unpack.  This is confirmed real
-// hardware behavior that games such as Ape Escape 3 depend on.
-template < uint idx, uint mode, bool doMask, class T >
-static void UNPACK_V4(u32* dest, const T* src)
-{
-	writeXYZW<tParam>(OFFSET_X, *(dest+0), *(src+0));
-	writeXYZW<tParam>(OFFSET_Y, *(dest+1), *(src+1));
-	writeXYZW<tParam>(OFFSET_Z, *(dest+2), *(src+2));
-	writeXYZW<tParam>(OFFSET_W, *(dest+3), *(src+3));
-}
-
-// V4_5 unpacks do not support the MODE register, and act as mode==0 always.
-template< uint idx, bool doMask >
-static void UNPACK_V4_5(u32 *dest, const u32* src)
-{
-	u32 data = *src;
-
-	writeXYZW<idx,0,doMask>(OFFSET_X, *(dest+0),	((data & 0x001f) << 3));
-	writeXYZW<idx,0,doMask>(OFFSET_Y, *(dest+1),	((data & 0x03e0) >> 2));
-	writeXYZW<idx,0,doMask>(OFFSET_Z, *(dest+2),	((data & 0x7c00) >> 7));
-	writeXYZW<idx,0,doMask>(OFFSET_W, *(dest+3),	((data & 0x8000) >> 8));
-}
-
-// =====================================================================================================
-
-// --------------------------------------------------------------------------------------
-//  Main table for function unpacking.
-// --------------------------------------------------------------------------------------
-// The extra data bsize/dsize/etc are all duplicated between the doMask enabled and
-// disabled versions.  This is probably simpler and more efficient than bothering
-// to generate separate tables.
-//
-// The double-cast function pointer nonsense is to appease GCC, which gives some rather
-// cryptic error about being unable to deduce the type parameters (I think it's a bug
-// relating to __fastcall, which I recall having some other places as well).  It's fixed
-// by explicitly casting the function to itself prior to casting it to what we need it
-// to be cast as. --air
-//
-
-#define _upk				(UNPACKFUNCTYPE)
-#define _unpk(usn, bits)	(UNPACKFUNCTYPE_##usn##bits)
-
-#define UnpackFuncSet( vt, idx, mode, usn, doMask ) \
-	(UNPACKFUNCTYPE)_unpk(u,32)		UNPACK_##vt<idx, mode, doMask, u32>, \
-	(UNPACKFUNCTYPE)_unpk(usn,16)	UNPACK_##vt<idx, mode, doMask, usn##16>, \
-	(UNPACKFUNCTYPE)_unpk(usn,8)	UNPACK_##vt<idx, mode, doMask, usn##8> \
-
-#define UnpackV4_5set(idx, doMask) \
-	(UNPACKFUNCTYPE)_unpk(u,32) UNPACK_V4_5<idx, doMask> \
-
-#define UnpackModeSet(idx, mode) \
-	UnpackFuncSet( S,  idx, mode, s, 0 ), NULL,  \
-	UnpackFuncSet( V2, idx, mode, s, 0 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, s, 0 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, s, 0 ), UnpackV4_5set(idx, 0), \
- \
-	UnpackFuncSet( S,  idx, mode, s, 1 ), NULL,  \
-	UnpackFuncSet( V2, idx, mode, s, 1 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, s, 1 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, s, 1 ), UnpackV4_5set(idx, 1), \
- \
-	UnpackFuncSet( S,  idx, mode, u, 0 ), NULL,  \
-	UnpackFuncSet( V2, idx, mode, u, 0 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, u, 0 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, u, 0 ), UnpackV4_5set(idx, 0), \
- \
-	UnpackFuncSet( S,  idx, mode, u, 1 ), NULL,  \
-	UnpackFuncSet( V2, idx, mode, u, 1 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, u, 1 ), NULL,  \
-	UnpackFuncSet( V4, idx, mode, u, 1 ), UnpackV4_5set(idx, 1)
-
-alignas(16) const UNPACKFUNCTYPE VIFfuncTable[2][4][4 * 4 * 2 * 2] =
-{
-	{
-		{ UnpackModeSet(0,0) },
-		{ UnpackModeSet(0,1) },
-		{ UnpackModeSet(0,2) },
-		{ UnpackModeSet(0,3) }
-	},
-
-	{
-		{ UnpackModeSet(1,0) },
-		{ UnpackModeSet(1,1) },
-		{ UnpackModeSet(1,2) },
-		{ UnpackModeSet(1,3) }
-	}
-};
+#include "GS/GSVector.h"
 
 //----------------------------------------------------------------------------
 // Unpack Setup Code
@@ -263,15 +100,6 @@ template void vifUnpackSetup<1>(const u32 *data);
 
 alignas(16) nVifStruct nVif[2];
 
-// Interpreter-style SSE unpacks.  Array layout matches the interpreter C unpacks.
-//  ([USN][Masking][Unpack Type]) [curCycle]
-alignas(16) nVifCall nVifUpk[(2 * 2 * 16) * 4];
-
-// This is used by the interpreted SSE unpacks only.  Recompiled SSE unpacks
-// and the interpreted C unpacks use the vif.MaskRow/MaskCol members directly.
-//  [MaskNumber][CycleNumber][Vector]
-alignas(16) u32 nVifMask[3][4][4] = {};
-
 // Number of bytes of data in the source stream needed for each vector.
 // [equivalent to ((32 >> VL) * (VN+1)) / 8]
 alignas(16) const u8 nVifT[16] = {
@@ -293,26 +121,6 @@ alignas(16) const u8 nVifT[16] = {
 	2, // V4-5
 };
 
-// ----------------------------------------------------------------------------
-template <int idx, bool doMode, bool isFill>
-__ri void _nVifUnpackLoop(const u8* data);
-
-typedef void FnType_VifUnpackLoop(const u8* data);
-typedef FnType_VifUnpackLoop* Fnptr_VifUnpackLoop;
-
-// Unpacks Until 'Num' is 0
-alignas(16) static const Fnptr_VifUnpackLoop UnpackLoopTable[2][2][2] = {
-	{
-		{_nVifUnpackLoop<0, 0, 0>, _nVifUnpackLoop<0, 0, 1>},
-		{_nVifUnpackLoop<0, 1, 0>, _nVifUnpackLoop<0, 1, 1>},
-	},
-	{
-		{_nVifUnpackLoop<1, 0, 0>, _nVifUnpackLoop<1, 0, 1>},
-		{_nVifUnpackLoop<1, 1, 0>, _nVifUnpackLoop<1, 1, 1>},
-	},
-};
-// ----------------------------------------------------------------------------
-
 void resetNewVif(int idx)
 {
 	// Safety Reset : Reassign all VIF structure info, just in case the VU1 pointers have
@@ -393,122 +201,183 @@ _vifT int nVifUnpack(const u8* data)
 template int nVifUnpack<0>(const u8* data);
 template int nVifUnpack<1>(const u8* data);
 
-// This is used by the interpreted SSE unpacks only.  Recompiled SSE unpacks
-// and the interpreted C unpacks use the vif.MaskRow/MaskCol members directly.
-static void setMasks(const vifStruct& vif, const VIFregisters& v)
+// ----------------------------------------------------------------------------
+//  Interpreted unpacks
+// ----------------------------------------------------------------------------
+// Used whenever the recompiled unpack can't be, which is when the destination wraps
+// around the end of VU memory.
+//
+// _nVifUnpack unpacks a whole 'num' run per call.  The unpack type, sign extension and
+// mode are template parameters, so the loop body is a handful of vector ops with no calls
+// in it, and masking is turned into per-cycle lane selects once per run rather than per
+// vector.  It works on 128 bits at a time, each vector depends on the write cycle and in
+// modes 2 and 3 on the row register, so there's nothing for wider ISAs to add.  The
+// scalar reference it has to match lives with the unpack benchmark in pcsx2-gsrunner.
+
+// Reads one vector of the given type and spreads it over XYZW the way the VIF does.
+// S repeats X, V2 writes XYXY, and V3 is read as V4 with W coming from the next
+// vector, which is confirmed hardware behaviour (Ape Escape 3 depends on it).
+template <uint upkType, bool usn>
+static __fi GSVector4i nVifDecode(const u8* src)
 {
-	for (int i = 0; i < 16; i++)
+	switch (upkType)
 	{
-		int m = (v.mask >> (i * 2)) & 3;
-		switch (m)
+		case 0x0: return GSVector4i(*(const s32*)src); // S-32
+		case 0x1: return GSVector4i(usn ? static_cast<s32>(*(const u16*)src) : static_cast<s32>(*(const s16*)src)); // S-16
+		case 0x2: return GSVector4i(usn ? static_cast<s32>(*(const u8*)src) : static_cast<s32>(*(const s8*)src)); // S-8
+
+		case 0x4: return GSVector4i::loadl(src).xyxy(); // V2-32
+		case 0x5: return (usn ? GSVector4i::load(*(const s32*)src).u16to32() : GSVector4i::load(*(const s32*)src).i16to32()).xyxy();
+		case 0x6: return (usn ? GSVector4i::load(*(const u16*)src).u8to32() : GSVector4i::load(*(const u16*)src).i8to32()).xyxy();
+
+		case 0x8: // V3-32
+		case 0xc: // V4-32
+			return GSVector4i::load<false>(src);
+		case 0x9: // V3-16
+		case 0xd: // V4-16
+			return usn ? GSVector4i::loadl(src).u16to32() : GSVector4i::loadl(src).i16to32();
+		case 0xa: // V3-8
+		case 0xe: // V4-8
+			return usn ? GSVector4i::load(*(const s32*)src).u8to32() : GSVector4i::load(*(const s32*)src).i8to32();
+
+		case 0xf: // V4-5
 		{
-			case 0: // Data
-				nVifMask[0][i / 4][i % 4] = 0xffffffff;
-				nVifMask[1][i / 4][i % 4] = 0;
-				nVifMask[2][i / 4][i % 4] = 0;
-				break;
-			case 1: // MaskRow
-				nVifMask[0][i / 4][i % 4] = 0;
-				nVifMask[1][i / 4][i % 4] = 0;
-				nVifMask[2][i / 4][i % 4] = vif.MaskRow._u32[i % 4];
-				break;
-			case 2: // MaskCol
-				nVifMask[0][i / 4][i % 4] = 0;
-				nVifMask[1][i / 4][i % 4] = 0;
-				nVifMask[2][i / 4][i % 4] = vif.MaskCol._u32[i / 4];
-				break;
-			case 3: // Write Protect
-				nVifMask[0][i / 4][i % 4] = 0;
-				nVifMask[1][i / 4][i % 4] = 0xffffffff;
-				nVifMask[2][i / 4][i % 4] = 0;
-				break;
+			const u32 data = *(const u16*)src;
+			return GSVector4i((data & 0x001f) << 3, (data & 0x03e0) >> 2, (data & 0x7c00) >> 7, (data & 0x8000) >> 8);
 		}
+
+		default:
+			return GSVector4i::zero();
 	}
 }
 
-// ----------------------------------------------------------------------------
-//  Unpacking Optimization notes:
-// ----------------------------------------------------------------------------
-// Some games send a LOT of single-cycle packets (God of War, SotC, TriAce games, etc),
-// so we always need to be weary of keeping loop setup code optimized.  It's not always
-// a "win" to move code outside the loop, like normally in most other loop scenarios.
-//
-// The biggest bottleneck of the current code is the call/ret needed to invoke the SSE
-// unpackers.  A better option is to generate the entire vifRegs.num loop code as part
-// of the SSE template, and inline the SSE code into the heart of it.  This both avoids
-// the call/ret and opens the door for resolving some register dependency chains in the
-// current emitted functions.  (this is what zero's SSE does to get it's final bit of
-// speed advantage over the new vif). --air
-//
-// The BEST optimizatin strategy here is to use data available to us from the UNPACK dispatch
-// -- namely the unpack type and mask flag -- in combination mode and usn values -- to
-// generate ~600 special versions of this function.  But since it's an interpreter, who gives
-// a crap?  Really? :p
-//
-
-// size - size of the packet fragment incoming from DMAC.
-template <int idx, bool doMode, bool isFill>
-__ri void _nVifUnpackLoop(const u8* data)
+template <uint upkType, bool usn, uint mode>
+static void nVifUnpackLoop(vifStruct& vif, VIFregisters& vifRegs, u8* vuMem, u32 addrMask, const u8* data, bool isFill)
 {
-
-	vifStruct& vif = MTVU_VifX;
-	VIFregisters& vifRegs = MTVU_VifXRegs;
+	const u32 vSize = nVifT[upkType];
 
 	// skipSize used for skipping writes only
-	const int skipSize = (vifRegs.cycle.cl - vifRegs.cycle.wl) * 16;
+	const u32 skipSize = (vifRegs.cycle.cl - vifRegs.cycle.wl) * 16;
 
-	if (!doMode && (vif.cmd & 0x10))
-		setMasks(vif, vifRegs);
+	// Lane selects for each write cycle (cl is clamped to 3 for these).
+	// A lane takes the unpacked data, MaskRow, MaskCol or is write protected.
+	GSVector4i dataLanes[4], rowLanes[4], colData[4], protectLanes[4];
+	bool anyProtect[4];
+	for (int c = 0; c < 4; c++)
+	{
+		int sel[4] = {};
+		if (vif.cmd & 0x10)
+		{
+			for (int i = 0; i < 4; i++)
+				sel[i] = (vifRegs.mask >> (c * 8 + i * 2)) & 3;
+		}
 
-	const int usn    = !!vif.usn;
-	const int upkNum = vif.cmd & 0x1f;
-	const u8& vSize  = nVifT[upkNum & 0x0f];
-	//uint vl = vif.cmd & 0x03;
-	//uint vn = (vif.cmd >> 2) & 0x3;
-	//uint vSize = ((32 >> vl) * (vn+1)) / 8;		// size of data (in bytes) used for each write cycle
+		dataLanes[c] = GSVector4i(sel[0] == 0 ? -1 : 0, sel[1] == 0 ? -1 : 0, sel[2] == 0 ? -1 : 0, sel[3] == 0 ? -1 : 0);
+		rowLanes[c] = GSVector4i(sel[0] == 1 ? -1 : 0, sel[1] == 1 ? -1 : 0, sel[2] == 1 ? -1 : 0, sel[3] == 1 ? -1 : 0);
+		colData[c] = GSVector4i(static_cast<int>(vif.MaskCol._u32[c])) &
+					 GSVector4i(sel[0] == 2 ? -1 : 0, sel[1] == 2 ? -1 : 0, sel[2] == 2 ? -1 : 0, sel[3] == 2 ? -1 : 0);
+		protectLanes[c] = GSVector4i(sel[0] == 3 ? -1 : 0, sel[1] == 3 ? -1 : 0, sel[2] == 3 ? -1 : 0, sel[3] == 3 ? -1 : 0);
+		anyProtect[c] = !protectLanes[c].allfalse();
+	}
 
-	const nVifCall* fnbase = &nVifUpk[((usn * 2 * 16) + upkNum) * (4 * 1)];
-	const UNPACKFUNCTYPE ft = VIFfuncTable[idx][doMode ? vifRegs.mode : 0][((usn * 2 * 16) + upkNum)];
+	// Work on local copies of the cycle state, so the stores to VU memory
+	// don't force them back out to vif/vifRegs on every vector.
+	const int cycleCL = vifRegs.cycle.cl;
+	const int cycleWL = vifRegs.cycle.wl;
+	u32 addr = vif.tag.addr;
+	u32 num = vifRegs.num;
+	int cl = vif.cl;
+
+	// Modes 2 and 3 write back to the row register, keep it in a register for the run.
+	GSVector4i row = GSVector4i::load<true>(&vif.MaskRow);
 
 	do
 	{
-		u8* dest = (u8*)(vuRegs[idx].Mem + (vif.tag.addr & (idx ? 0x3ff0 : 0xff0)));
+		const int c = std::min(cl, 3);
+		u8* dest = vuMem + (addr & addrMask);
 
-		if (doMode)
-		{
-			ft(dest, data);
-		}
-		else
-		{
-			uint cl3 = std::min(vif.cl, 3);
-			fnbase[cl3](dest, data);
-		}
+		GSVector4i value = nVifDecode<upkType, usn>(data);
+		if (mode == 1 || mode == 2)
+			value = value.add32(row);
+		if (mode == 2 || mode == 3)
+			row = row.blend8(value, dataLanes[c]);
+
+		GSVector4i out = (value & dataLanes[c]) | (row & rowLanes[c]) | colData[c];
+		if (anyProtect[c])
+			out = out.blend8(GSVector4i::load<true>(dest), protectLanes[c]);
+		GSVector4i::store<true>(dest, out);
 
-		vif.tag.addr += 16;
-		--vifRegs.num;
-		++vif.cl;
+		addr += 16;
+		--num;
+		++cl;
 
 		if (isFill)
 		{
-			if (vif.cl <= vifRegs.cycle.cl)
+			if (cl <= cycleCL)
 				data += vSize;
-			else if (vif.cl == vifRegs.cycle.wl)
-				vif.cl = 0;
+			else if (cl == cycleWL)
+				cl = 0;
 		}
 		else
 		{
 			data += vSize;
 
-			if (vif.cl >= vifRegs.cycle.wl)
+			if (cl >= cycleWL)
 			{
-				vif.tag.addr += skipSize;
-				vif.cl = 0;
+				addr += skipSize;
+				cl = 0;
 			}
 		}
-	} while (vifRegs.num);
+	} while (num);
+
+	vif.tag.addr = addr;
+	vifRegs.num = num;
+	vif.cl = cl;
+
+	if (mode == 2 || mode == 3)
+		GSVector4i::store<true>(&vif.MaskRow, row);
+}
+
+template <uint upkType, bool usn>
+static void nVifUnpackMode(vifStruct& vif, VIFregisters& vifRegs, u8* vuMem, u32 addrMask, const u8* data, uint mode, bool isFill)
+{
+	// V4-5 unpacks do not support the MODE register, and act as mode==0 always.
+	switch ((upkType == 0xf) ? 0 : (mode & 3))
+	{
+		case 0: nVifUnpackLoop<upkType, usn, 0>(vif, vifRegs, vuMem, addrMask, data, isFill); break;
+		case 1: nVifUnpackLoop<upkType, usn, 1>(vif, vifRegs, vuMem, addrMask, data, isFill); break;
+		case 2: nVifUnpackLoop<upkType, usn, 2>(vif, vifRegs, vuMem, addrMask, data, isFill); break;
+		default: nVifUnpackLoop<upkType, usn, 3>(vif, vifRegs, vuMem, addrMask, data, isFill); break;
+	}
+}
+
+template <bool usn>
+static void nVifUnpackType(vifStruct& vif, VIFregisters& vifRegs, u8* vuMem, u32 addrMask, const u8* data, uint mode, bool isFill)
+{
+#define UPK_CASE(upkType) \
+	case upkType: nVifUnpackMode<upkType, usn>(vif, vifRegs, vuMem, addrMask, data, mode, isFill); break
+
+	switch (vif.cmd & 0xf)
+	{
+		UPK_CASE(0x0); UPK_CASE(0x1); UPK_CASE(0x2);
+		UPK_CASE(0x4); UPK_CASE(0x5); UPK_CASE(0x6);
+		UPK_CASE(0x8); UPK_CASE(0x9); UPK_CASE(0xa);
+		UPK_CASE(0xc); UPK_CASE(0xd); UPK_CASE(0xe); UPK_CASE(0xf);
+		default: break;
+	}
+
+#undef UPK_CASE
 }
 
 __fi void _nVifUnpack(int idx, const u8* data, uint mode, bool isFill)
 {
-	UnpackLoopTable[idx][!!mode][isFill](data);
+	vifStruct& vif = MTVU_VifX;
+	VIFregisters& vifRegs = MTVU_VifXRegs;
+	u8* vuMem = vuRegs[idx].Mem;
+	const u32 addrMask = idx ? 0x3ff0 : 0xff0;
+
+	if (vif.usn)
+		nVifUnpackType<true>(vif, vifRegs, vuMem, addrMask, data, mode, isFill);
+	else
+		nVifUnpackType<false>(vif, vifRegs, vuMem, addrMask, data, mode, isFill);
 }
@@ -43,6 +43,7 @@
 #include "IopMem.h"
 #include "Host.h"
 #include "R5900.h"
+#include "SaveStateDelta.h"
 
 using namespace vtlb_private;
 
@@ -614,7 +615,9 @@ static bool vtlb_GetMainMemoryOffsetFromPtr(uptr ptr, u32* mainmem_offset, u32*
 	if (ptr >= (uptr)eeMem->Main && page_end <= (uptr)eeMem->ZeroRead)
 	{
 		const u32 eemem_offset = static_cast<u32>(ptr - (uptr)eeMem->Main);
-		const bool writeable   = ((eemem_offset < Ps2MemSize::MainRam) ? (mmap_GetRamPageInfo(eemem_offset) != ProtMode_Write) : true);
+		const bool writeable   = ((eemem_offset < Ps2MemSize::MainRam) ?
+			(mmap_GetRamPageInfo(eemem_offset) != ProtMode_Write &&
+				!SaveStateDelta::IsWriteProtected(SaveStateDelta::TRACK_EE_RAM, eemem_offset >> __pageshift)) : true);
 		*mainmem_offset        = (eemem_offset + HostMemoryMap::EEmemOffset);
 		*mainmem_size          = (offsetof(EEVM_MemoryAllocMess, ZeroRead) - eemem_offset);
 		prot->m_read           = true;
@@ -630,7 +633,8 @@ static bool vtlb_GetMainMemoryOffsetFromPtr(uptr ptr, u32* mainmem_offset, u32*
 		*mainmem_offset = iopmem_offset + HostMemoryMap::IOPmemOffset;
 		*mainmem_size = (offsetof(IopVM_MemoryAllocMess, P) - iopmem_offset);
 		prot->m_read  = true;
-		prot->m_write = true;
+		prot->m_write = (iopmem_offset >= Ps2MemSize::IopRam ||
+			!SaveStateDelta::IsWriteProtected(SaveStateDelta::TRACK_IOP_RAM, iopmem_offset >> __pageshift));
 		prot->m_exec  = false;
 		return true;
 	}
@@ -800,6 +804,19 @@ void vtlb_ClearLoadStoreInfo(void)
 	s_fastmem_faulting_pcs.clear();
 }
 
+// Forgets the loads and stores compiled into [code_start, code_end), so code compiled there
+// again isn't backpatched with the old info.
+void vtlb_ClearLoadStoreInfo(uptr code_start, uptr code_end)
+{
+	for (auto it = s_fastmem_backpatch_info.begin(); it != s_fastmem_backpatch_info.end();)
+	{
+		if (it->first >= code_start && it->first < code_end)
+			it = s_fastmem_backpatch_info.erase(it);
+		else
+			++it;
+	}
+}
+
 void vtlb_AddLoadStoreInfo(uptr code_address, u32 code_size, u32 guest_pc, u32 gpr_bitmask, u32 fpr_bitmask, u8 address_register, u8 data_register, u8 size_in_bits, bool is_signed, bool is_load, bool is_fpr)
 {
 	auto iter = s_fastmem_backpatch_info.find(code_address);
@@ -1011,6 +1028,9 @@ static constexpr size_t VMAP_SIZE = sizeof(VTLBVirtual) * VTLB_VMAP_ITEMS;
 // [TODO] basemem - request allocating memory at the specified virtual location, which can allow
 //    for easier debugging and/or 3rd party cheat programs.  If 0, the operating system
 //    default is used.
+static void mmap_ProtectTrackedRam(u32 first_page, u32 page_count, bool writable);
+static void mmap_ProtectTrackedIopRam(u32 first_page, u32 page_count, bool writable);
+
 bool vtlb_Core_Alloc(void)
 {
 	// Can't return regions to the bump allocator
@@ -1056,6 +1076,9 @@ bool vtlb_Core_Alloc(void)
 		return false;
 	}
 
+	SaveStateDelta::RegisterTracked(SaveStateDelta::TRACK_EE_RAM, eeMem->Main, 1, Ps2MemSize::MainRam, mmap_ProtectTrackedRam);
+	SaveStateDelta::RegisterTracked(SaveStateDelta::TRACK_IOP_RAM, iopMem->Main, 1, Ps2MemSize::IopRam, mmap_ProtectTrackedIopRam);
+
 	return true;
 }
 
@@ -1088,6 +1111,8 @@ void vtlb_Alloc_Ppmap(void)
 void vtlb_Core_Free(void)
 {
 	PageProtectionMode mode;
+	SaveStateDelta::UnregisterTracked(SaveStateDelta::TRACK_EE_RAM);
+	SaveStateDelta::UnregisterTracked(SaveStateDelta::TRACK_IOP_RAM);
 	HostSys::RemovePageFaultHandler(&vtlb_private::PageFaultHandler);
 
 	mode.m_read  = false;
@@ -1238,29 +1263,98 @@ static __fi void mmap_ClearCpuBlock(uint offset)
 	Cpu->Clear(m_PageProtectInfo[rampage].ReverseRamMap, __pagesize);
 }
 
+// Write protection for delta savestates. Pages holding recompiled code stay protected, so
+// unprotecting goes run by run in between them.
+static void mmap_ProtectTrackedRam(u32 first_page, u32 page_count, bool writable)
+{
+	PageProtectionMode mode;
+	mode.m_read  = true;
+	mode.m_write = writable;
+	mode.m_exec  = false;
+
+	const u32 end_page = first_page + page_count;
+	u32 rampage = first_page;
+	while (rampage < end_page)
+	{
+		if (writable && m_PageProtectInfo[rampage].Mode == ProtMode_Write)
+		{
+			rampage++;
+			continue;
+		}
+
+		u32 run_end = rampage + 1;
+		if (writable)
+		{
+			while (run_end < end_page && m_PageProtectInfo[run_end].Mode != ProtMode_Write)
+				run_end++;
+		}
+		else
+			run_end = end_page;
+
+		HostSys::MemProtect(&eeMem->Main[rampage << __pageshift], (run_end - rampage) << __pageshift, mode);
+		if (CHECK_FASTMEM)
+			vtlb_UpdateFastmemProtection(rampage << __pageshift, (run_end - rampage) << __pageshift, mode);
+		rampage = run_end;
+	}
+}
+
+static void mmap_ProtectTrackedIopRam(u32 first_page, u32 page_count, bool writable)
+{
+	PageProtectionMode mode;
+	mode.m_read  = true;
+	mode.m_write = writable;
+	mode.m_exec  = false;
+	HostSys::MemProtect(&iopMem->Main[first_page << __pageshift], page_count << __pageshift, mode);
+	if (CHECK_FASTMEM)
+		vtlb_UpdateFastmemProtection(0x1c000000 + (first_page << __pageshift), page_count << __pageshift, mode);
+}
+
+// A write to a protected page of EE RAM, for recompiled code or for delta savestates.
+static bool mmap_HandleRamWrite(uptr ptr)
+{
+	const uptr offset = ptr - (uptr)eeMem->Main;
+	if (offset >= Ps2MemSize::MainRam)
+		return false;
+
+	const u32 rampage = offset >> __pageshift;
+	if (!SaveStateDelta::TrackWrite(SaveStateDelta::TRACK_EE_RAM, rampage) ||
+		m_PageProtectInfo[rampage].Mode == ProtMode_Write)
+	{
+		mmap_ClearCpuBlock(offset);
+	}
+	return true;
+}
+
 bool vtlb_private::PageFaultHandler(const PageFaultInfo& info)
 {
 	u32 vaddr;
 	if (CHECK_FASTMEM && vtlb_GetGuestAddress(info.addr, &vaddr))
 	{
 		uptr ptr = (uptr)PSM(vaddr);
-		uptr offset = (ptr - (uptr)eeMem->Main);
-		if (ptr && m_PageProtectInfo[offset >> __pageshift].Mode == ProtMode_Write)
+		if (ptr)
 		{
-			mmap_ClearCpuBlock(offset);
-			return true;
+			const uptr offset = (ptr - (uptr)eeMem->Main);
+			if (offset < Ps2MemSize::MainRam &&
+				(m_PageProtectInfo[offset >> __pageshift].Mode == ProtMode_Write ||
+					SaveStateDelta::IsWriteProtected(SaveStateDelta::TRACK_EE_RAM, offset >> __pageshift)))
+			{
+				return mmap_HandleRamWrite(ptr);
+			}
+
+			// IOP RAM, when it's protected for delta savestates.
+			if (offset >= Ps2MemSize::MainRam && SaveStateDelta::HandleWriteFault(ptr))
+				return true;
 		}
 		return vtlb_BackpatchLoadStore(info.pc, info.addr);
 	}
 	else
 	{
 		// get bad virtual address
-		uptr offset = info.addr - (uptr)eeMem->Main;
-		if (offset >= Ps2MemSize::MainRam)
-			return false;
+		if (mmap_HandleRamWrite(info.addr))
+			return true;
 
-		mmap_ClearCpuBlock(offset);
-		return true;
+		// IOP RAM and GS memory are write protected for delta savestates.
+		return SaveStateDelta::HandleWriteFault(info.addr);
 	}
 }
 
@@ -1279,4 +1373,7 @@ void mmap_ResetBlockTracking(void)
 		HostSys::MemProtect(eeMem->Main, Ps2MemSize::MainRam, mode);
 	if (CHECK_FASTMEM)
 		vtlb_UpdateFastmemProtection(0, Ps2MemSize::MainRam, mode);
+
+	// Pages which haven't been written since the last delta savestate stay protected.
+	SaveStateDelta::ReprotectTracked(SaveStateDelta::TRACK_EE_RAM);
 }
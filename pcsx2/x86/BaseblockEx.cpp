@@ -14,38 +14,186 @@
  */
 
 
+#include <algorithm>
+
+#include "../../common/Console.h"
+
 #include "BaseblockEx.h"
 
+const BaseBlocks::Page* BaseBlocks::FindPage(u32 page) const
+{
+	const auto it = pages.find(page);
+	return (it != pages.end()) ? &it->second : nullptr;
+}
+
 BASEBLOCKEX* BaseBlocks::New(u32 startpc, uptr fnptr)
 {
 	std::pair<linkiter_t, linkiter_t> range = links.equal_range(startpc);
 	for (linkiter_t i = range.first; i != range.second; ++i)
 		*(u32*)i->second = fnptr - (i->second + 4);
 
-	return blocks.insert(startpc, fnptr);
+	BASEBLOCKEX* block;
+	if (!free_blocks.empty())
+	{
+		block = free_blocks.back();
+		free_blocks.pop_back();
+	}
+	else
+	{
+		block = &storage.emplace_back();
+	}
+
+	*block = {};
+	block->startpc = startpc;
+	block->fnptr = fnptr;
+
+	// Blocks sharing a startpc go after the existing ones, so the newest is found first.
+	Page& page = pages[startpc >> PAGE_SHIFT];
+	const auto pos = std::upper_bound(page.blocks.begin(), page.blocks.end(), startpc,
+		[](u32 pc, const BASEBLOCKEX* b) { return pc < b->startpc; });
+	page.blocks.insert(pos, block);
+
+	stats.compiled++;
+	if (page.removed > 0)
+		stats.recompiled++;
+	stats.live++;
+	stats.pages = static_cast<u32>(pages.size());
+	return block;
 }
 
-int BaseBlocks::LastIndex(u32 startpc) const
+void BaseBlocks::SetSize(BASEBLOCKEX* block, u32 size)
 {
-	if (0 == blocks.size())
-		return -1;
+	block->size = size;
+	max_size = std::max(max_size, size * 4);
+}
 
-	int imin = 0, imax = blocks.size() - 1;
+BASEBLOCKEX* BaseBlocks::Get(u32 pc) const
+{
+	// Nothing starting further back than the largest block can reach pc.
+	const u32 lowest = (pc > max_size) ? (pc - max_size) : 0;
+	for (u32 page = pc >> PAGE_SHIFT;; page--)
+	{
+		if (const Page* p = FindPage(page))
+		{
+			const auto pos = std::upper_bound(p->blocks.begin(), p->blocks.end(), pc,
+				[](u32 addr, const BASEBLOCKEX* b) { return addr < b->startpc; });
+			if (pos != p->blocks.begin())
+			{
+				BASEBLOCKEX* block = *(pos - 1);
+				if (block->startpc < lowest)
+					return nullptr;
+				if (block->size && pc >= block->startpc + block->size * 4)
+					return nullptr;
+				return block;
+			}
+		}
+
+		if (page <= (lowest >> PAGE_SHIFT))
+			return nullptr;
+	}
+}
+
+BASEBLOCKEX* BaseBlocks::First(u32 start, u32 end) const
+{
+	if (end <= start)
+		return nullptr;
 
-	while (imin != imax)
+	for (u32 page = start >> PAGE_SHIFT; page <= ((end - 1) >> PAGE_SHIFT); page++)
 	{
-		const int imid = (imin + imax + 1) >> 1;
+		const Page* p = FindPage(page);
+		if (!p)
+			continue;
 
-		if (blocks[imid].startpc > startpc)
-			imax = imid - 1;
-		else
-			imin = imid;
+		const auto pos = std::lower_bound(p->blocks.begin(), p->blocks.end(), start,
+			[](const BASEBLOCKEX* b, u32 pc) { return b->startpc < pc; });
+		if (pos != p->blocks.end())
+			return ((*pos)->startpc < end) ? *pos : nullptr;
 	}
 
-	return imin;
+	return nullptr;
 }
 
-void BaseBlocks::Link(u32 pc, s32* jumpptr)
+void BaseBlocks::Overlapping(u32 start, u32 end, std::vector<BASEBLOCKEX*>& out) const
+{
+	out.clear();
+
+	const u32 lowest = (start > max_size) ? (start - max_size) : 0;
+	if (end <= lowest)
+		return;
+
+	for (u32 page = lowest >> PAGE_SHIFT; page <= ((end - 1) >> PAGE_SHIFT); page++)
+	{
+		const Page* p = FindPage(page);
+		if (!p)
+			continue;
+
+		for (BASEBLOCKEX* block : p->blocks)
+		{
+			if (block->startpc >= end)
+				break;
+			if (block->startpc >= lowest)
+				out.push_back(block);
+		}
+	}
+}
+
+void BaseBlocks::All(std::vector<BASEBLOCKEX*>& out) const
+{
+	out.clear();
+	out.reserve(stats.live);
+
+	for (const auto& it : pages)
+		out.insert(out.end(), it.second.blocks.begin(), it.second.blocks.end());
+}
+
+void BaseBlocks::Remove(BASEBLOCKEX* block)
+{
+	std::pair<linkiter_t, linkiter_t> range = links.equal_range(block->startpc);
+	for (linkiter_t i = range.first; i != range.second; ++i)
+		*(u32*)i->second = recompiler - (i->second + 4);
+
+	const auto out = outgoing.find(block);
+	if (out != outgoing.end())
+	{
+		for (const auto& [pc, jumpptr] : out->second)
+		{
+			range = links.equal_range(pc);
+			for (linkiter_t i = range.first; i != range.second; ++i)
+			{
+				if (i->second == jumpptr)
+				{
+					links.erase(i);
+					stats.unlinked++;
+					break;
+				}
+			}
+		}
+		outgoing.erase(out);
+	}
+
+	const auto it = pages.find(block->startpc >> PAGE_SHIFT);
+	if (it == pages.end())
+		return;
+
+	Page& page = it->second;
+	const auto pos = std::find(page.blocks.begin(), page.blocks.end(), block);
+	if (pos == page.blocks.end())
+		return;
+
+	page.blocks.erase(pos);
+	free_blocks.push_back(block);
+
+	page.removed++;
+	if (page.removed > stats.churn_removed)
+	{
+		stats.churn_page = it->first << PAGE_SHIFT;
+		stats.churn_removed = page.removed;
+	}
+	stats.removed++;
+	stats.live--;
+}
+
+void BaseBlocks::Link(u32 pc, s32* jumpptr, const BASEBLOCKEX* from)
 {
 	BASEBLOCKEX* targetblock = Get(pc);
 	if (targetblock && targetblock->startpc == pc)
@@ -53,4 +201,32 @@ void BaseBlocks::Link(u32 pc, s32* jumpptr)
 	else
 		*jumpptr = (s32)(recompiler - (sptr)(jumpptr + 1));
 	links.insert(std::pair<u32, uptr>(pc, (uptr)jumpptr));
+	if (from)
+		outgoing[from].emplace_back(pc, (uptr)jumpptr);
+}
+
+void BaseBlocks::LogStats(const char* name) const
+{
+	if (stats.compiled == 0)
+		return;
+
+	Console.WriteLn("(%s) %llu blocks compiled, %llu removed, %llu recompiled into invalidated pages, %u live in %u pages",
+		name, static_cast<unsigned long long>(stats.compiled), static_cast<unsigned long long>(stats.removed),
+		static_cast<unsigned long long>(stats.recompiled), stats.live, stats.pages);
+	if (stats.churn_removed > 0)
+		Console.WriteLn("(%s) Most invalidated page: %08x (%u blocks removed)", name, stats.churn_page, stats.churn_removed);
+	if (stats.unlinked > 0)
+		Console.WriteLn("(%s) %llu jumps unlinked from removed blocks, %zu still linked", name,
+			static_cast<unsigned long long>(stats.unlinked), links.size());
+}
+
+void BaseBlocks::Reset()
+{
+	links.clear();
+	outgoing.clear();
+	pages.clear();
+	storage.clear();
+	free_blocks.clear();
+	max_size = 4;
+	stats = {};
 }
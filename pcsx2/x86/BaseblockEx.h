@@ -18,9 +18,9 @@
 #include "../../common/Pcsx2Defs.h"
 #include "../../common/Pcsx2Types.h"
 
-#include <cstring>
-
-#include <map> // used by BaseBlockEx
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 // Every potential jump point in the PS2's addressable memory has a BASEBLOCK
 // associated with it. So that means a BASEBLOCK for every 4 bytes of PS2
@@ -39,176 +39,98 @@ struct BASEBLOCKEX
 	u32 x86size; // The size in byte of the translated x86 instructions
 };
 
-class BaseBlockArray
+// --------------------------------------------------------------------------------------
+//  BaseBlocks
+// --------------------------------------------------------------------------------------
+// Blocks are bucketed by the 4KB page their startpc lies in: a hash map from page to a
+// short vector kept in startpc order. Adding or removing a block only touches its own
+// page, and range lookups only visit the pages which can hold a block reaching into the
+// range, so constant invalidation (self-modifying code, overlay loaders) stays cheap.
+// Block records never move once allocated, so pointers stay valid until the block is
+// removed.
+class BaseBlocks
 {
-	s32 _Reserved;
-	s32 _Size;
-	BASEBLOCKEX* blocks;
-
-	__fi void resize(s32 size)
-	{
-		BASEBLOCKEX* newMem = new BASEBLOCKEX[size];
-		if (blocks)
-		{
-			memcpy(newMem, blocks, _Reserved * sizeof(BASEBLOCKEX));
-			delete[] blocks;
-		}
-		blocks = newMem;
-	}
-
-	void reserve(u32 size)
-	{
-		resize(size);
-		_Reserved = size;
-	}
-
 public:
-	~BaseBlockArray()
-	{
-		if (blocks)
-			delete[] blocks;
-	}
+	struct Stats
+	{
+		u64 compiled;      // blocks added
+		u64 recompiled;    // blocks added to a page which already had a block removed
+		u64 removed;       // blocks invalidated
+		u64 unlinked;      // jumps dropped along with the block they were compiled into
+		u32 live;          // blocks currently indexed
+		u32 pages;         // pages which held a block
+		u32 churn_page;    // address of the page with the most removed blocks
+		u32 churn_removed; // blocks removed from that page
+	};
 
-	BaseBlockArray(s32 size)
-		: _Reserved(0)
-		, _Size(0)
-		, blocks(NULL)
+	BaseBlocks()
+		: recompiler(0)
 	{
-		reserve(size);
 	}
 
-	BASEBLOCKEX* insert(u32 startpc, uptr fnptr)
+	void SetJITCompile(const void *recompiler_)
 	{
-		if (_Size + 1 >= _Reserved)
-		{
-			reserve(_Reserved + 0x2000); // some games requires even more!
-		}
-
-		// Insert the the new BASEBLOCKEX by startpc order
-		int imin = 0, imax = _Size, imid;
-
-		while (imin < imax)
-		{
-			imid = (imin + imax) >> 1;
-
-			if (blocks[imid].startpc > startpc)
-				imax = imid;
-			else
-				imin = imid + 1;
-		}
-
-		if (imin < _Size)
-		{
-			// make a hole for a new block.
-			memmove(blocks + imin + 1, blocks + imin, (_Size - imin) * sizeof(BASEBLOCKEX));
-		}
-
-		memset((blocks + imin), 0, sizeof(BASEBLOCKEX));
-		blocks[imin].startpc = startpc;
-		blocks[imin].fnptr = fnptr;
-
-		_Size++;
-		return &blocks[imin];
+		recompiler = reinterpret_cast<uptr>(recompiler_);
 	}
 
-	__fi BASEBLOCKEX& operator[](int idx) const
-	{
-		return *(blocks + idx);
-	}
+	BASEBLOCKEX* New(u32 startpc, uptr fnptr);
 
-	void clear()
-	{
-		_Size = 0;
-	}
+	// Sets the size in dwords once the block has been recompiled.
+	void SetSize(BASEBLOCKEX* block, u32 size);
 
-	__fi u32 size() const
-	{
-		return _Size;
-	}
+	// Returns the block with the highest startpc at or below pc if it covers pc, like the
+	// sorted lookup this replaced. A block whose size isn't set yet counts as covering pc.
+	BASEBLOCKEX* Get(u32 pc) const;
 
-	__fi void erase(s32 first, s32 last)
-	{
-		int range = last - first;
+	// First block starting in [start, end), or null.
+	BASEBLOCKEX* First(u32 start, u32 end) const;
 
-		if (last < _Size)
-		{
-			memmove(blocks + first, blocks + last, (_Size - last) * sizeof(BASEBLOCKEX));
-		}
+	// Fills out with every block which may overlap [start, end), ordered by startpc
+	// (blocks sharing a startpc stay in the order they were added). Callers still check
+	// the extents, the list includes blocks which end before start.
+	void Overlapping(u32 start, u32 end, std::vector<BASEBLOCKEX*>& out) const;
 
-		_Size -= range;
-	}
-};
+	// Fills out with every block currently indexed, in no particular order.
+	void All(std::vector<BASEBLOCKEX*>& out) const;
 
-class BaseBlocks
-{
-protected:
-	typedef std::multimap<u32, uptr>::iterator linkiter_t;
+	// Points every jump linked to the block back at the recompiler and forgets the block,
+	// along with any jumps out of it which were linked with the block as their source.
+	void Remove(BASEBLOCKEX* block);
 
-	// switch to a hash map later?
-	std::multimap<u32, uptr> links;
-	uptr recompiler;
-	BaseBlockArray blocks;
+	// Points jumpptr at the block starting at pc (or the recompiler), and keeps it pointed
+	// there as that block comes and goes. Passing the block the jump was compiled into lets
+	// Remove() drop the link once that code is dead, rather than patching it forever.
+	void Link(u32 pc, s32* jumpptr, const BASEBLOCKEX* from = nullptr);
 
-public:
-	BaseBlocks()
-		: recompiler(0)
-		, blocks(0x4000)
-	{
-	}
+	// Largest block size in bytes seen since the last reset.
+	u32 GetMaxSize() const { return max_size; }
 
-	void SetJITCompile(const void *recompiler_)
-	{
-		recompiler = reinterpret_cast<uptr>(recompiler_);
-	}
+	const Stats& GetStats() const { return stats; }
+	void LogStats(const char* name) const;
 
-	BASEBLOCKEX* New(u32 startpc, uptr fnptr);
-	int LastIndex(u32 startpc) const;
+	void Reset();
 
-	__fi int Index(u32 startpc) const
-	{
-		int idx = LastIndex(startpc);
+private:
+	static constexpr u32 PAGE_SHIFT = 12;
 
-		if ((idx == -1) || (startpc < blocks[idx].startpc) ||
-			((blocks[idx].size) && (startpc >= blocks[idx].startpc + blocks[idx].size * 4)))
-			return -1;
-		return idx;
-	}
-
-	__fi BASEBLOCKEX* operator[](int idx)
-	{
-		if (idx < 0 || idx >= (int)blocks.size())
-			return 0;
-
-		return &blocks[idx];
-	}
-
-	__fi BASEBLOCKEX* Get(u32 startpc)
-	{
-		return (*this)[Index(startpc)];
-	}
+	typedef std::unordered_multimap<u32, uptr>::iterator linkiter_t;
 
-	__fi void Remove(int first, int last)
+	struct Page
 	{
-		int idx = first;
-		do
-		{
-			//u32 startpc = blocks[idx].startpc;
-			std::pair<linkiter_t, linkiter_t> range = links.equal_range(blocks[idx].startpc);
-			for (linkiter_t i = range.first; i != range.second; ++i)
-				*(u32*)i->second = recompiler - (i->second + 4);
-		} while (idx++ < last);
-
-		// TODO: remove links from this block?
-		blocks.erase(first, last + 1);
-	}
+		std::vector<BASEBLOCKEX*> blocks; // ordered by startpc
+		u32 removed = 0;
+	};
 
-	void Link(u32 pc, s32* jumpptr);
+	const Page* FindPage(u32 page) const;
 
-	__fi void Reset()
-	{
-		blocks.clear();
-		links.clear();
-	}
+	std::unordered_multimap<u32, uptr> links;
+	std::unordered_map<const BASEBLOCKEX*, std::vector<std::pair<u32, uptr>>> outgoing;
+	std::unordered_map<u32, Page> pages;
+	std::deque<BASEBLOCKEX> storage;
+	std::vector<BASEBLOCKEX*> free_blocks;
+	uptr recompiler;
+	u32 max_size = 4;
+	Stats stats = {};
 };
 
 #define PC_GETBLOCK_(x, reclut) ((BASEBLOCK*)(reclut[((u32)(x)) >> 16] + (x) * (sizeof(BASEBLOCK) / 4)))
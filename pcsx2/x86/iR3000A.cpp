@@ -35,9 +35,15 @@
 #include "../Config.h"
 
 #include "../../common/AlignedMalloc.h"
+#include "../../common/Console.h"
 #include "../../common/FileSystem.h"
 #include "../../common/Path.h"
 
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
 using namespace x86Emitter;
 
 extern void psxBREAK();
@@ -56,6 +62,18 @@ static BASEBLOCK* recROM = NULL; // and here
 static BASEBLOCK* recROM1 = NULL; // also here
 static BASEBLOCK* recROM2 = NULL; // also here
 static BaseBlocks recBlocks;
+static std::vector<BASEBLOCKEX*> s_clearBlocks;
+
+// Execution counts for each compiled block, when ProfileIOPBlocks is set. The counters are
+// bumped from the recompiled code, so they live in a deque where they never move.
+struct IopBlockProfile
+{
+	u32 startpc;
+	u32 size;
+	u64 count;
+};
+static std::deque<IopBlockProfile> s_blockProfile;
+static IopBlockProfile* s_pCurBlockProfile = NULL;
 static u8* recPtr = NULL;
 u32 psxpc; // recompiler psxpc
 int psxbranch; // set for branch
@@ -814,6 +832,78 @@ static void recAlloc(void)
 	_DynGen_Dispatchers();
 }
 
+// Names the module each block belongs to by the export table which starts it. This reads
+// memory as it is now, so a module which has since been unloaded can be misnamed.
+static void iopFindExportTables(u32 start, u32 end, std::vector<std::pair<u32, std::string>>& tables)
+{
+	for (u32 addr = start; addr < end; addr += 4)
+	{
+		if (iopMemRead32(addr) == 0x41c00000 && iopMemRead32(addr + 4) == 0)
+			tables.emplace_back(addr, iopMemReadString(addr + 12, 8));
+	}
+}
+
+static void iopLogBlockProfile()
+{
+	if (s_blockProfile.empty())
+		return;
+
+	// A block recompiled after being invalidated counts as the same block.
+	std::unordered_map<u32, IopBlockProfile> blocks;
+	u64 total = 0;
+	for (const IopBlockProfile& profile : s_blockProfile)
+	{
+		IopBlockProfile& block = blocks[profile.startpc];
+		block.startpc = profile.startpc;
+		block.size = std::max(block.size, profile.size);
+		block.count += profile.count;
+		total += profile.count;
+	}
+	s_blockProfile.clear();
+
+	if (total == 0)
+		return;
+
+	std::vector<std::pair<u32, std::string>> tables;
+	iopFindExportTables(0, Ps2MemSize::IopRam, tables);
+	iopFindExportTables(0x1fc00000, 0x1fc00000 + Ps2MemSize::Rom, tables);
+	const auto module_name = [&tables](u32 pc) -> const char* {
+		const auto it = std::upper_bound(tables.begin(), tables.end(), pc,
+			[](u32 addr, const std::pair<u32, std::string>& table) { return addr < table.first; });
+		return (it != tables.begin()) ? (it - 1)->second.c_str() : "?";
+	};
+
+	std::unordered_map<std::string, u64> modules;
+	std::vector<IopBlockProfile> sorted;
+	sorted.reserve(blocks.size());
+	for (const auto& [pc, block] : blocks)
+	{
+		modules[module_name(pc)] += block.count;
+		sorted.push_back(block);
+	}
+
+	std::vector<std::pair<std::string, u64>> sorted_modules(modules.begin(), modules.end());
+	std::sort(sorted_modules.begin(), sorted_modules.end(),
+		[](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+	const size_t top = std::min<size_t>(sorted.size(), 20);
+	std::partial_sort(sorted.begin(), sorted.begin() + top, sorted.end(),
+		[](const IopBlockProfile& lhs, const IopBlockProfile& rhs) { return lhs.count > rhs.count; });
+
+	Console.WriteLn("(IOP Rec) %llu block executions over %zu blocks", static_cast<unsigned long long>(total), blocks.size());
+	for (size_t i = 0; i < std::min<size_t>(sorted_modules.size(), 10); i++)
+	{
+		Console.WriteLn("(IOP Rec)   %-8s %5.2f%%", sorted_modules[i].first.c_str(),
+			100.0 * static_cast<double>(sorted_modules[i].second) / static_cast<double>(total));
+	}
+	for (size_t i = 0; i < top; i++)
+	{
+		Console.WriteLn("(IOP Rec)   %08x %-8s %4u ops %12llu %5.2f%%", sorted[i].startpc, module_name(sorted[i].startpc),
+			sorted[i].size, static_cast<unsigned long long>(sorted[i].count),
+			100.0 * static_cast<double>(sorted[i].count) / static_cast<double>(total));
+	}
+}
+
 void recResetIOP(void)
 {
 	recAlloc();
@@ -864,6 +954,8 @@ void recResetIOP(void)
 	if (s_pInstCache)
 		memset(s_pInstCache, 0, sizeof(EEINST) * s_nInstCacheSize);
 
+	iopLogBlockProfile();
+	recBlocks.LogStats("IOP Rec");
 	recBlocks.Reset();
 	g_psxMaxRecMem = 0;
 
@@ -873,6 +965,8 @@ void recResetIOP(void)
 
 static void recShutdown(void)
 {
+	iopLogBlockProfile();
+
 	delete recMem;
 	recMem = NULL;
 
@@ -926,33 +1020,35 @@ static __fi u32 psxRecClearMem(u32 pc)
 	pc = HWADDR(pc);
 
 	u32 lowerextent = pc, upperextent = pc + 4;
-	int blockidx = recBlocks.Index(pc);
 
-	while (BASEBLOCKEX* pexblock = recBlocks[blockidx - 1])
+	if (recBlocks.Get(pc))
 	{
-		if (pexblock->startpc + pexblock->size * 4 <= lowerextent)
-			break;
-
-		lowerextent = std::min(lowerextent, pexblock->startpc);
-		blockidx--;
-	}
+		const auto overlaps = [&lowerextent](const BASEBLOCKEX* pexblock) {
+			return pexblock->startpc >= lowerextent || pexblock->startpc + pexblock->size * 4 > lowerextent;
+		};
 
-	int toRemoveFirst = blockidx;
-
-	while (BASEBLOCKEX* pexblock = recBlocks[blockidx])
-	{
-		if (pexblock->startpc >= upperextent)
-			break;
-
-		lowerextent = std::min(lowerextent, pexblock->startpc);
-		upperextent = std::max(upperextent, pexblock->startpc + pexblock->size * 4);
+		// Grow the range until it covers every block reaching into it.
+		u32 lower, upper;
+		do
+		{
+			lower = lowerextent;
+			upper = upperextent;
+			recBlocks.Overlapping(lower, upper, s_clearBlocks);
+			for (const BASEBLOCKEX* pexblock : s_clearBlocks)
+			{
+				if (!overlaps(pexblock))
+					continue;
 
-		blockidx++;
-	}
+				lowerextent = std::min(lowerextent, pexblock->startpc);
+				upperextent = std::max(upperextent, pexblock->startpc + pexblock->size * 4);
+			}
+		} while (lowerextent != lower || upperextent != upper);
 
-	if (toRemoveFirst != blockidx)
-	{
-		recBlocks.Remove(toRemoveFirst, (blockidx - 1));
+		for (BASEBLOCKEX* pexblock : s_clearBlocks)
+		{
+			if (overlaps(pexblock))
+				recBlocks.Remove(pexblock);
+		}
 	}
 
 	iopClearRecLUT(PSX_GETBLOCK(lowerextent), (upperextent - lowerextent) / 4);
@@ -1022,7 +1118,7 @@ void psxSetBranchImm(u32 imm)
 	_psxFlushCall(FLUSH_EVERYTHING);
 	iPsxBranchTest(imm, imm <= psxpc);
 
-	recBlocks.Link(HWADDR(imm), xJcc32(Jcc_Unconditional, 0));
+	recBlocks.Link(HWADDR(imm), xJcc32(Jcc_Unconditional, 0), s_pCurBlockEx);
 }
 
 static __fi u32 psxScaleBlockCycles()
@@ -1190,6 +1286,15 @@ static void iopRecRecompile(const u32 startpc)
 	s_pCurBlock->m_pFnptr = ((uptr)x86Ptr);
 	s_psxBlockCycles = 0;
 
+	if (EmuConfig.Cpu.Recompiler.ProfileIOPBlocks)
+	{
+		s_pCurBlockProfile = &s_blockProfile.emplace_back();
+		*s_pCurBlockProfile = {};
+		s_pCurBlockProfile->startpc = HWADDR(startpc);
+		xMOV64(rax, (sptr)&s_pCurBlockProfile->count);
+		xADD(ptr64[rax], 1);
+	}
+
 	// reset recomp state variables
 	psxpc = startpc;
 	g_psxHasConstReg = g_psxFlushedConstReg = 1;
@@ -1318,7 +1423,9 @@ StartRecomp:
 		psxRecompileNextInstruction(false, false);
 	}
 
-	s_pCurBlockEx->size = (psxpc - startpc) >> 2;
+	recBlocks.SetSize(s_pCurBlockEx, (psxpc - startpc) >> 2);
+	if (s_pCurBlockProfile)
+		s_pCurBlockProfile->size = s_pCurBlockEx->size;
 
 	if (!(psxpc & 0x10000000))
 		g_psxMaxRecMem = std::max((psxpc & ~0xa0000000), g_psxMaxRecMem);
@@ -1344,7 +1451,7 @@ StartRecomp:
 		{
 			_psxFlushCall(FLUSH_EVERYTHING);
 			xMOV(ptr32[&psxRegs.pc], psxpc);
-			recBlocks.Link(HWADDR(s_nEndBlock), xJcc32(Jcc_Unconditional, 0));
+			recBlocks.Link(HWADDR(s_nEndBlock), xJcc32(Jcc_Unconditional, 0), s_pCurBlockEx);
 			psxbranch = 3;
 		}
 	}
@@ -1355,6 +1462,7 @@ StartRecomp:
 
 	s_pCurBlock = NULL;
 	s_pCurBlockEx = NULL;
+	s_pCurBlockProfile = NULL;
 }
 
 R3000Acpu psxRec = {
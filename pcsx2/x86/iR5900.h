@@ -61,8 +61,9 @@ extern bool s_nBlockInterlocked; // Current block has VU0 interlocking
 
 extern bool g_recompilingDelaySlot;
 
-// Used for generating backpatch thunks for fastmem.
-u8* recBeginThunk(void);
+// Used for generating backpatch thunks for fastmem. code_address is the load/store in a
+// block which is going to jump to the thunk.
+u8* recBeginThunk(uptr code_address);
 u8* recEndThunk(void);
 
 // used when processing branches
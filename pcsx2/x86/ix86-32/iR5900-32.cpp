@@ -31,7 +31,9 @@
 #include "x86/iR5900Analysis.h"
 
 #include "common/AlignedMalloc.h"
+#include "common/Console.h"
 #include "common/FastJmp.h"
+#include "common/Timer.h"
 
 // Only for MOVQ workaround.
 #include "common/emitter/internal.h"
@@ -40,6 +42,24 @@ using namespace x86Emitter;
 using namespace R5900;
 
 static bool eeRecNeedsReset = false;
+
+// The rec cache is split into regions which are compiled into in turn. When the last one is full,
+// the blocks in the oldest region are retired and it's compiled into again, rather than throwing
+// the whole cache away. Fastmem thunks go wherever code is being compiled at the time, so a block
+// backpatched to jump to a thunk in the retired region is retired with it.
+static constexpr u32 eeRecCacheRegions = 4;
+static u8* eeRecRegionStart[eeRecCacheRegions + 1]; // the last one is the end of the cache
+static u32 eeRecRegion = 0;
+static std::vector<uptr> eeRecThunkSites[eeRecCacheRegions]; // loads/stores jumping to a thunk in each region
+static bool eeRecCacheFull = false;
+static struct
+{
+	u64 flushes; // resets because the cache filled up
+	u64 retired; // regions retired
+	u64 blocks;  // blocks retired with them
+	u64 bytes;   // code thrown away by either
+	u64 start;   // timer value the counts began at
+} eeRecCacheStats;
 static bool eeCpuExecuting = false;
 static bool eeRecExitRequested = false;
 static bool g_resetEeScalingStats = false;
@@ -77,6 +97,9 @@ static BASEBLOCK* recROM1 = NULL; // also here
 static BASEBLOCK* recROM2 = NULL; // also here
 
 static BaseBlocks recBlocks;
+static std::vector<BASEBLOCKEX*> s_clearBlocks;
+static std::vector<BASEBLOCKEX*> s_overlapBlocks;
+static std::vector<BASEBLOCKEX*> s_retireBlocks;
 static u8* recPtr = NULL;
 static EEINST* s_pInstCache = NULL;
 static u32 s_nInstCacheSize = 0;
@@ -257,34 +280,27 @@ static void recClear(u32 addr, u32 size)
 		return;
 	addr = HWADDR(addr);
 
-	int blockidx = recBlocks.LastIndex(addr + size * 4 - 4);
+	const u32 end = addr + size * 4;
+	recBlocks.Overlapping(addr, end, s_clearBlocks);
 
-	if (blockidx == -1)
+	if (s_clearBlocks.empty())
 		return;
 
 	u32 lowerextent = (u32)-1, upperextent = 0, ceiling = (u32)-1;
 
-	BASEBLOCKEX* pexblock = recBlocks[blockidx + 1];
-	if (pexblock)
+	// Only the first block a cleared block could reach into matters for the ceiling.
+	if (BASEBLOCKEX* pexblock = recBlocks.First(end, end + recBlocks.GetMaxSize()))
 		ceiling = pexblock->startpc;
 
-	int toRemoveLast = blockidx;
-
-	while ((pexblock = recBlocks[blockidx]))
+	for (auto it = s_clearBlocks.rbegin(); it != s_clearBlocks.rend(); ++it)
 	{
+		BASEBLOCKEX* pexblock = *it;
 		u32 blockstart = pexblock->startpc;
 		u32 blockend = pexblock->startpc + pexblock->size * 4;
 		BASEBLOCK* pblock = PC_GETBLOCK(blockstart);
 
 		if (pblock == s_pCurBlock)
-		{
-			if (toRemoveLast != blockidx)
-			{
-				recBlocks.Remove((blockidx + 1), toRemoveLast);
-			}
-			toRemoveLast = --blockidx;
 			continue;
-		}
 
 		if (blockend <= addr)
 		{
@@ -296,12 +312,9 @@ static void recClear(u32 addr, u32 size)
 		upperextent = std::max(upperextent, blockend);
 		pblock->m_pFnptr = ((uptr)JITCompile);
 
-		blockidx--;
+		recBlocks.Remove(pexblock);
 	}
 
-	if (toRemoveLast != blockidx)
-		recBlocks.Remove((blockidx + 1), toRemoveLast);
-
 	upperextent = std::min(upperextent, ceiling);
 
 	if (upperextent > lowerextent)
@@ -513,8 +526,33 @@ alignas(16) static u8 manual_counter[Ps2MemSize::MainRam >> 12];
 
 
 ////////////////////////////////////////////////////
+static void recLogCacheStats(void)
+{
+	if (eeRecCacheStats.flushes > 0 || eeRecCacheStats.retired > 0)
+	{
+		const double minutes = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - eeRecCacheStats.start) / 60.0;
+		Console.WriteLn("EE Rec: %llu cache regions retired (%.2f per minute, %llu blocks), %llu full flushes, %llu KB of code thrown away",
+			static_cast<unsigned long long>(eeRecCacheStats.retired),
+			(minutes > 0.0) ? (static_cast<double>(eeRecCacheStats.retired) / minutes) : 0.0,
+			static_cast<unsigned long long>(eeRecCacheStats.blocks),
+			static_cast<unsigned long long>(eeRecCacheStats.flushes),
+			static_cast<unsigned long long>(eeRecCacheStats.bytes / _1kb));
+	}
+	eeRecCacheStats = {};
+	eeRecCacheStats.start = Common::Timer::GetCurrentValue();
+}
+
 static void recResetRaw(void)
 {
+	if (eeRecCacheFull && recMem)
+	{
+		eeRecCacheStats.flushes++;
+		eeRecCacheStats.bytes += recPtr - recMem->GetPtr();
+	}
+	else
+		recLogCacheStats();
+	eeRecCacheFull = false;
+
 	recAlloc();
 
 	recMem->Reset();
@@ -534,6 +572,7 @@ static void recResetRaw(void)
 	if (s_pInstCache)
 		memset(s_pInstCache, 0, sizeof(EEINST) * s_nInstCacheSize);
 
+	recBlocks.LogStats("EE Rec");
 	recBlocks.Reset();
 	mmap_ResetBlockTracking();
 	vtlb_ClearLoadStoreInfo();
@@ -544,12 +583,22 @@ static void recResetRaw(void)
 	recPtr = xGetPtr();
 #endif
 
+	const uptr region_size = (recMem->GetPtrEnd() - recPtr) / eeRecCacheRegions;
+	for (u32 i = 0; i < eeRecCacheRegions; i++)
+		eeRecRegionStart[i] = recPtr + i * region_size;
+	eeRecRegionStart[eeRecCacheRegions] = recMem->GetPtrEnd();
+	eeRecRegion = 0;
+	for (std::vector<uptr>& sites : eeRecThunkSites)
+		sites.clear();
+
 	g_branch = 0;
 	g_resetEeScalingStats = true;
 }
 
 static void recShutdown(void)
 {
+	recLogCacheStats();
+
 	delete recMem;
 	recMem = NULL;
 	safe_aligned_free(recRAMCopy);
@@ -717,11 +766,17 @@ void SetBranchImm(u32 imm)
 	iBranchTest(imm);
 }
 
-u8* recBeginThunk(void)
+u8* recBeginThunk(uptr code_address)
 {
-	// if recPtr reached the mem limit reset whole mem
-	if (recPtr >= (recMem->GetPtrEnd() - _64kb))
+	// Moving on to the next region has to wait for the next recompile, but if thunks alone
+	// fill up the current one, reset whole mem.
+	if (recPtr >= (eeRecRegionStart[eeRecRegion + 1] - _16kb))
+	{
+		eeRecCacheFull  = true;
 		eeRecNeedsReset = true;
+	}
+
+	eeRecThunkSites[eeRecRegion].push_back(code_address);
 
 	xSetPtr(recPtr);
 	recPtr = xGetAlignedCallTarget();
@@ -1119,7 +1174,7 @@ static void iBranchTest(u32 newpc)
 		if (newpc == 0xffffffff)
 			xJS(DispatcherReg);
 		else
-			recBlocks.Link(HWADDR(newpc), xJcc32(Jcc_Signed, 0));
+			recBlocks.Link(HWADDR(newpc), xJcc32(Jcc_Signed, 0), s_pCurBlockEx);
 	}
 	xJMP((const void*)DispatcherEvent);
 }
@@ -1614,7 +1669,7 @@ static bool recSkipTimeoutLoop(s32 reg, bool is_timeout_loop)
 	xMOV(ptr32[&cpuRegs.GPR.r[reg].UL[0]], edx); // write back new value of v0
 	xJNZ((void*)DispatcherEvent); // jump to dispatcher if new v0 is not zero (i.e. an event)
 	xMOV(ptr32[&cpuRegs.pc], s_nEndBlock); // otherwise end of loop
-	recBlocks.Link(HWADDR(s_nEndBlock), xJcc32(Jcc_Unconditional, 0));
+	recBlocks.Link(HWADDR(s_nEndBlock), xJcc32(Jcc_Unconditional, 0), s_pCurBlockEx);
 
 	g_branch = 1;
 	pc = s_nEndBlock;
@@ -1622,20 +1677,59 @@ static bool recSkipTimeoutLoop(s32 reg, bool is_timeout_loop)
 	return true;
 }
 
+// Moves on to the next cache region once the current one is full, retiring the blocks compiled
+// into it and the ones jumping to thunks in it. Only called from recRecompile(), so none of them
+// is running.
+static void recRetireRegion(void)
+{
+	eeRecRegion = (eeRecRegion + 1) % eeRecCacheRegions;
+
+	const uptr start = (uptr)eeRecRegionStart[eeRecRegion];
+	const uptr end   = (uptr)eeRecRegionStart[eeRecRegion + 1];
+
+	std::vector<uptr>& sites = eeRecThunkSites[eeRecRegion];
+	std::sort(sites.begin(), sites.end());
+
+	recBlocks.All(s_retireBlocks);
+	for (BASEBLOCKEX* pexblock : s_retireBlocks)
+	{
+		const auto site = std::lower_bound(sites.begin(), sites.end(), pexblock->fnptr);
+		const bool has_thunk = (site != sites.end() && *site < pexblock->fnptr + pexblock->x86size);
+		if (!has_thunk && (pexblock->fnptr < start || pexblock->fnptr >= end))
+			continue;
+
+		// Other blocks' jumps to it go back to the recompiler, and its own jumps are forgotten.
+		BASEBLOCK* pblock = PC_GETBLOCK(pexblock->startpc);
+		if (pblock->m_pFnptr == pexblock->fnptr)
+			pblock->m_pFnptr = ((uptr)JITCompile);
+
+		recBlocks.Remove(pexblock);
+		eeRecCacheStats.blocks++;
+	}
+	sites.clear();
+
+	vtlb_ClearLoadStoreInfo(start, end);
+
+	eeRecCacheStats.retired++;
+	eeRecCacheStats.bytes += end - start;
+	recPtr = eeRecRegionStart[eeRecRegion];
+}
+
 static void recRecompile(const u32 startpc)
 {
 	u32 i = 0;
 	u32 willbranch3 = 0;
 
-	// if recPtr reached the mem limit reset whole mem
-	if (recPtr >= (recMem->GetPtrEnd() - _64kb))
-		eeRecNeedsReset = true;
-
 	if (eeRecNeedsReset)
 	{
 		eeRecNeedsReset = false;
 		recResetRaw();
 	}
+	// if recPtr reached the end of the current region, retire the next one and compile into it
+	else if (recPtr >= (eeRecRegionStart[eeRecRegion + 1] - _64kb))
+	{
+		recRetireRegion();
+	}
 
 	xSetPtr(recPtr);
 	recPtr = xGetAlignedCallTarget();
@@ -2002,15 +2096,14 @@ StartRecomp:
 			recompileNextInstruction(false, false); // For the love of recursion, batman!
 	}
 
-	s_pCurBlockEx->size = (pc - startpc) >> 2;
+	recBlocks.SetSize(s_pCurBlockEx, (pc - startpc) >> 2);
 
 	if (HWADDR(pc) <= Ps2MemSize::MainRam)
 	{
-		BASEBLOCKEX* oldBlock;
-		int i;
-		i = recBlocks.LastIndex(HWADDR(pc) - 4);
-		while ((oldBlock = recBlocks[i--]))
+		recBlocks.Overlapping(HWADDR(startpc), HWADDR(pc), s_overlapBlocks);
+		for (auto it = s_overlapBlocks.rbegin(); it != s_overlapBlocks.rend(); ++it)
 		{
+			BASEBLOCKEX* oldBlock = *it;
 			if (oldBlock == s_pCurBlockEx)
 				continue;
 			if (oldBlock->startpc >= HWADDR(pc))
@@ -2064,7 +2157,7 @@ StartRecomp:
 			{
 				xMOV(ptr32[&cpuRegs.pc], pc);
 				xADD(ptr32[&cpuRegs.cycle], scaleblockcycles());
-				recBlocks.Link(HWADDR(pc), xJcc32(Jcc_Unconditional, 0));
+				recBlocks.Link(HWADDR(pc), xJcc32(Jcc_Unconditional, 0), s_pCurBlockEx);
 			}
 		}
 	}
@@ -796,7 +796,7 @@ void vtlb_DynBackpatchLoadStore(uptr code_address, u32 code_size, u32 guest_pc,
 #else
 	static constexpr u32 SHADOW_SIZE = 0;
 #endif
-	u8* thunk = recBeginThunk();
+	u8* thunk = recBeginThunk(code_address);
 
 	// save regs
 	u32 num_gprs = 0;
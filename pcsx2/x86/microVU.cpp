@@ -22,6 +22,7 @@
 #include "microVU.h"
 
 #include "../../common/AlignedMalloc.h"
+#include "../../common/Timer.h"
 
 //------------------------------------------------------------------
 // Micro VU - Main Functions
@@ -109,10 +110,27 @@ void mVUreset(microVU& mVU, bool resetReserve)
 	u8* z = mVU.cache;
 	mVU.prog.x86start = z;
 	mVU.prog.x86ptr   = z;
-	mVU.prog.x86end   = z + ((mVU.cacheSize - mVUcacheSafeZone) * _1mb);
+	mVU.prog.x86end   = z + ((mVU.cacheSize / mVUcacheRegions - mVUcacheSafeZone) * _1mb);
+	mVU.prog.region   = 0;
+	for (u32 i = 0; i < mVUcacheRegions; i++)
+		mVU.prog.regionEnd[i] = z + i * (mVU.cacheSize / mVUcacheRegions) * _1mb;
+
+	if (resetReserve)
+		mVUcacheLogStats(mVU);
+
+	if (doProgCache)
+		mVUdiskCacheStore(mVU, resetReserve);
+
+	mVUprogLogStats(mVU);
+
+	if (!mVU.prog.index)
+		mVU.prog.index = new microProgIndex();
+	mVU.prog.index->stale.clear();
+	mVU.prog.index->warming.clear();
 
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
+		mVU.prog.index->layouts[i].clear();
 		if (!mVU.prog.prog[i])
 		{
 			mVU.prog.prog[i] = new std::deque<microProgram*>();
@@ -140,6 +158,14 @@ void mVUclose(microVU& mVU)
 	delete mVU.cache_reserve;
 	mVU.cache_reserve = NULL;
 
+	if (doProgCache)
+		mVUdiskCacheStore(mVU, true);
+
+	mVUprogLogStats(mVU);
+	mVUcacheLogStats(mVU);
+	delete mVU.prog.index;
+	mVU.prog.index = NULL;
+
 	// Delete Programs and Block Managers
 	for (u32 i = 0; i < (mVU.progSize / 2); i++)
 	{
@@ -182,6 +208,10 @@ __ri void mVUdeleteProg(microVU& mVU, microProgram*& prog)
 	}
 	delete prog->ranges;
 	prog->ranges = NULL;
+	delete prog->cacheEntries;
+	prog->cacheEntries = NULL;
+	delete prog->warmEntries;
+	prog->warmEntries = NULL;
 	safe_aligned_free(prog);
 }
 
@@ -192,9 +222,12 @@ __ri microProgram* mVUcreateProg(microVU& mVU, int startPC)
 	memset(prog, 0, sizeof(microProgram));
 	prog->idx = mVU.prog.total++;
 	prog->ranges = new std::deque<microRange>();
+	prog->cacheEntries = new std::vector<microCacheEntry>();
 	prog->startPC = startPC;
+	prog->lastUse = mVU.prog.stats.searches;
 	if(doWholeProgCompare)
 		mVUcacheProg(mVU, *prog); // Cache Micro Program
+	mVUprogIndexStale(mVU, *prog);
 	return prog;
 }
 
@@ -215,25 +248,234 @@ __ri void mVUcacheProg(microVU& mVU, microProgram& prog)
 	}
 }
 
-// Generate Hash for partial program based on compiled ranges...
-u64 mVUrangesHash(microVU& mVU, microProgram& prog)
+// Valid compiled ranges of a program in address order (or all of micro memory when
+// comparing whole programs), which is what it is indexed and compared by.
+static void mVUprogIndexRanges(microVU& mVU, const microProgram& prog, std::vector<microRange>& ranges)
+{
+	ranges.clear();
+	if (doWholeProgCompare)
+	{
+		ranges.push_back({0, static_cast<s32>(mVU.microMemSize)});
+		return;
+	}
+
+	for (const microRange& range : *prog.ranges)
+	{
+		if (mVUdiskCacheValidRange(mVU, range))
+			ranges.push_back(range);
+	}
+	std::sort(ranges.begin(), ranges.end(), [](const microRange& a, const microRange& b) { return a.start < b.start; });
+}
+
+// Ranges are hashed on their own and then combined, so a range shared by several
+// layouts only has to be hashed once per search.
+static u64 mVUprogIndexRangeHash(const u8* data, const microRange& range, std::unordered_map<u64, u64>& known)
+{
+	const u64 key = (static_cast<u64>(static_cast<u32>(range.start)) << 32) | static_cast<u32>(range.end);
+	const auto it = known.find(key);
+	if (it != known.end())
+		return it->second;
+
+	const u64 hash = XXH3_64bits(data + range.start, range.end - range.start);
+	known.emplace(key, hash);
+	return hash;
+}
+
+static u64 mVUprogIndexHash(const u8* data, const std::vector<microRange>& ranges, std::unordered_map<u64, u64>& known)
+{
+	u64 hash = 0;
+	for (const microRange& range : ranges)
+	{
+		const u64 range_hash = mVUprogIndexRangeHash(data, range, known);
+		hash = XXH3_64bits_withSeed(&range_hash, sizeof(range_hash), hash);
+	}
+	return hash;
+}
+
+// Queues a program to be (re)indexed, its ranges are about to change
+void mVUprogIndexStale(microVU& mVU, microProgram& prog)
+{
+	if (prog.stale)
+		return;
+
+	prog.stale = true;
+	mVU.prog.index->stale.push_back(&prog);
+}
+
+static void mVUprogIndexRemove(microVU& mVU, microProgram& prog)
+{
+	if (!prog.indexed)
+		return;
+
+	auto& layouts = mVU.prog.index->layouts[prog.startPC];
+	const auto layout = layouts.find(prog.layoutHash);
+	if (layout != layouts.end())
+	{
+		auto& progs = layout->second.progs;
+		auto& heads = layout->second.heads;
+		const auto head = heads.find(prog.headHash);
+		if (head != heads.end())
+			heads.erase(head);
+
+		const auto range = progs.equal_range(prog.dataHash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second == &prog)
+			{
+				progs.erase(it);
+				break;
+			}
+		}
+		if (progs.empty())
+			layouts.erase(layout);
+	}
+
+	prog.indexed = false;
+}
+
+// Brings the index up to date with programs which were created or compiled into since the last search
+static void mVUprogIndexFlush(microVU& mVU)
+{
+	microProgIndex& index = *mVU.prog.index;
+	if (index.stale.empty())
+		return;
+
+	std::vector<microRange> ranges;
+	std::unordered_map<u64, u64> known;
+	for (microProgram* prog : index.stale)
+	{
+		mVUprogIndexRemove(mVU, *prog);
+
+		const u8* data = reinterpret_cast<const u8*>(prog->data);
+		known.clear();
+		mVUprogIndexRanges(mVU, *prog, ranges);
+		prog->layoutHash = XXH3_64bits(ranges.data(), ranges.size() * sizeof(microRange));
+		prog->dataHash   = mVUprogIndexHash(data, ranges, known);
+		prog->headHash   = ranges.empty() ? 0 : mVUprogIndexRangeHash(data, ranges.front(), known);
+
+		microProgIndex::Layout& layout = index.layouts[prog->startPC][prog->layoutHash];
+		if (layout.progs.empty())
+			layout.ranges = ranges;
+		layout.progs.emplace(prog->dataHash, prog);
+		layout.heads.emplace(prog->headHash);
+
+		prog->indexed = true;
+		prog->stale   = false;
+	}
+	index.stale.clear();
+}
+
+void mVUprogLogStats(microVU& mVU)
+{
+	microProgStats& stats = mVU.prog.stats;
+	if (stats.searches > 0)
+	{
+		Console.WriteLn("microVU%u: %llu program searches, %llu found, %llu layouts probed, %llu full compares", mVU.index,
+			static_cast<unsigned long long>(stats.searches), static_cast<unsigned long long>(stats.hits),
+			static_cast<unsigned long long>(stats.probes), static_cast<unsigned long long>(stats.compares));
+	}
+	stats = {};
+}
+
+void mVUcacheLogStats(microVU& mVU)
 {
-	union
+	microCacheStats& stats = mVU.prog.cacheStats;
+	if (stats.retired > 0 || stats.flushes > 0)
 	{
-		u64 v64;
-		u32 v32[2];
-	} hash = {0};
+		const double minutes = Common::Timer::ConvertValueToSeconds(Common::Timer::GetCurrentValue() - stats.start) / 60.0;
+		Console.WriteLn("microVU%u: %llu rec-cache regions retired (%.2f per minute), %llu programs and %llu KB of code with them, %llu full flushes",
+			mVU.index, static_cast<unsigned long long>(stats.retired), (minutes > 0.0) ? (static_cast<double>(stats.retired) / minutes) : 0.0,
+			static_cast<unsigned long long>(stats.progs), static_cast<unsigned long long>(stats.bytes / _1kb),
+			static_cast<unsigned long long>(stats.flushes));
+	}
+	stats = {};
+	stats.start = Common::Timer::GetCurrentValue();
+}
+
+// Moves on to the next rec-cache region once the current one is full, throwing away every
+// program with code in it. Only called between executions, so none of it is running.
+void mVUretireRegion(microVU& mVU)
+{
+	const u32 regionSize = (mVU.cacheSize / mVUcacheRegions) * _1mb;
+	const u32 next       = (mVU.prog.region + 1) % mVUcacheRegions;
+	u8* const nextStart  = mVU.prog.x86start + next * regionSize;
+
+	mVU.prog.regionEnd[mVU.prog.region] = mVU.prog.x86ptr;
+
+	std::vector<microProgram*> gone;
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		microProgramList* list = mVU.prog.prog[i];
+		for (auto it = list->begin(); it != list->end();)
+		{
+			if ((*it)->regions & (1u << next))
+			{
+				gone.push_back(*it);
+				it = list->erase(it);
+			}
+			else
+				++it;
+		}
+	}
 
-	std::deque<microRange>::const_iterator it(prog.ranges->begin());
-	for (; it != prog.ranges->end(); ++it)
+	if (!gone.empty())
 	{
-		for (int i = it[0].start / 4; i < it[0].end / 4; i++)
+		std::sort(gone.begin(), gone.end());
+		const auto isGone = [&gone](const microProgram* prog) {
+			return std::binary_search(gone.begin(), gone.end(), prog);
+		};
+
+		// Nothing may refer to them once they are gone, they can be allocated again at the same address
+		for (u32 i = 0; i < (mVU.progSize / 2); i++)
+		{
+			if (mVU.prog.quick[i].prog && isGone(mVU.prog.quick[i].prog))
+			{
+				mVU.prog.quick[i].block = NULL;
+				mVU.prog.quick[i].prog  = NULL;
+			}
+
+			for (microProgram* prog : *mVU.prog.prog[i])
+			{
+				for (u32 j = 0; j < (mVU.progSize / 2); j++)
+				{
+					if (prog->block[j])
+						prog->block[j]->clearJumpCache(isGone);
+				}
+			}
+		}
+
+		if (mVU.prog.cur && isGone(mVU.prog.cur))
 		{
-			hash.v32[0] -= prog.data[i];
-			hash.v32[1] ^= prog.data[i];
+			mVU.prog.cur    = NULL;
+			mVU.prog.isSame = -1;
+		}
+
+		std::vector<microProgram*>& stale = mVU.prog.index->stale;
+		stale.erase(std::remove_if(stale.begin(), stale.end(), isGone), stale.end());
+		std::vector<microProgram*>& warming = mVU.prog.index->warming;
+		warming.erase(std::remove_if(warming.begin(), warming.end(), isGone), warming.end());
+
+		for (microProgram* prog : gone)
+		{
+			mVUprogIndexRemove(mVU, *prog);
+			if (doProgCache)
+				mVUdiskCacheStoreProg(mVU, *prog);
+			mVUdeleteProg(mVU, prog);
 		}
 	}
-	return hash.v64;
+
+	const u32 bytes = static_cast<u32>(mVU.prog.regionEnd[next] - nextStart);
+	if (bytes > 0 || !gone.empty())
+	{
+		mVU.prog.cacheStats.retired++;
+		mVU.prog.cacheStats.progs += gone.size();
+		mVU.prog.cacheStats.bytes += bytes;
+	}
+
+	mVU.prog.region          = next;
+	mVU.prog.regionEnd[next] = nextStart;
+	mVU.prog.x86ptr          = nextStart;
+	mVU.prog.x86end          = nextStart + regionSize - mVUcacheSafeZone * _1mb;
 }
 
 // Compare Cached microProgram to vuRegs[mVU.index].Micro
@@ -254,12 +496,42 @@ __fi bool mVUcmpProg(microVU& mVU, microProgram& prog)
 				return false;
 		}
 	}
-	mVU.prog.cleared = 0;
-	mVU.prog.cur = &prog;
-	mVU.prog.isSame = doWholeProgCompare ? 1 : -1;
 	return true;
 }
 
+// Finds the most recently used program which matches micro memory. A layout whose first range
+// matches none of its programs is skipped without hashing the rest, other ranges are hashed at
+// most once per search, and only programs with a matching hash get the full compare.
+static microProgram* mVUprogIndexFind(microVU& mVU, u32 startPC)
+{
+	microProgStats& stats = mVU.prog.stats;
+	const u8* micro = reinterpret_cast<const u8*>(vuRegs[mVU.index].Micro);
+	std::unordered_map<u64, u64>& known = mVU.prog.index->rangeHashes;
+	known.clear();
+
+	microProgram* found = nullptr;
+	for (const auto& it : mVU.prog.index->layouts[startPC])
+	{
+		const microProgIndex::Layout& layout = it.second;
+		stats.probes++;
+
+		if (!layout.ranges.empty() && !layout.heads.count(mVUprogIndexRangeHash(micro, layout.ranges.front(), known)))
+			continue;
+
+		const auto range = layout.progs.equal_range(mVUprogIndexHash(micro, layout.ranges, known));
+		for (auto prog = range.first; prog != range.second; ++prog)
+		{
+			if (found && prog->second->lastUse <= found->lastUse)
+				continue;
+
+			stats.compares++;
+			if (mVUcmpProg(mVU, *prog->second))
+				found = prog->second;
+		}
+	}
+	return found;
+}
+
 // Searches for Cached Micro Program and sets prog.cur to it (returns entry-point to program)
 _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 {
@@ -269,26 +541,27 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 
 	if (!quick.prog) // If null, we need to search for new program
 	{
-		std::deque<microProgram*>::iterator it(list->begin());
-		for (; it != list->end(); ++it)
+		mVU.prog.stats.searches++;
+		mVUprogIndexFlush(mVU);
+
+		if (microProgram* prog = mVUprogIndexFind(mVU, vuRegs[mVU.index].start_pc / 8))
 		{
-			bool b = mVUcmpProg(mVU, *it[0]);
+			mVU.prog.stats.hits++;
+			mVU.prog.cleared = 0;
+			mVU.prog.cur     = prog;
+			mVU.prog.isSame  = doWholeProgCompare ? 1 : -1;
+			prog->lastUse    = mVU.prog.stats.searches;
 
-			if (b)
-			{
-				quick.block = it[0]->block[startPC / 8];
-				quick.prog  = it[0];
-				list->erase(it);
-				list->push_front(quick.prog);
+			quick.block = prog->block[startPC / 8];
+			quick.prog  = prog;
 
-				// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
-				if (quick.block == nullptr)
-				{
-					void* entryPoint = mVUblockFetch(mVU, startPC, pState);
-					return entryPoint;
-				}
-				return mVUentryGet(mVU, quick.block, startPC, pState);
+			// Sanity check, in case for some reason the program compilation aborted half way through (JALR for example)
+			if (quick.block == nullptr)
+			{
+				void* entryPoint = mVUblockFetch(mVU, startPC, pState);
+				return entryPoint;
 			}
+			return mVUentryGet(mVU, quick.block, startPC, pState);
 		}
 
 		// If cleared and program not found, make a new program instance
@@ -299,6 +572,8 @@ _mVUt __fi void* mVUsearchProg(u32 startPC, uptr pState)
 		quick.block      = mVU.prog.cur->block[startPC/8];
 		quick.prog       = mVU.prog.cur;
 		list->push_front(mVU.prog.cur);
+		if (doProgCache)
+			mVUdiskCacheWarm(mVU, *mVU.prog.cur);
 		return entryPoint;
 	}
 
@@ -19,6 +19,9 @@
 #include <algorithm>
 #include <cstring> /* memset/memcpy */
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "Common.h"
 #include "VU.h"
@@ -52,29 +55,86 @@ struct microRange
 	s32 end;   // End PC   (The opcode the block ends with)
 };
 
+struct alignas(16) microCacheEntry
+{
+	microRegInfo pState; // Pipeline state the entry point was compiled for
+	u32 startPC;         // Start PC of the entry point
+};
+
 #define mProgSize (0x4000 / 4)
 struct microProgram
 {
 	u32                data [mProgSize];     // Holds a copy of the VU microProgram
 	microBlockManager* block[mProgSize / 2]; // Array of Block Managers
 	std::deque<microRange>* ranges;          // The ranges of the microProgram that have already been recompiled
+	std::vector<microCacheEntry>* cacheEntries; // Entry points compiled for this program (for the persistent program cache)
+	std::vector<microCacheEntry>* warmEntries;  // Saved entry points still to be precompiled (NULL when there are none)
 	u32 startPC; // Start PC of this program
 	int idx;     // Program index
+	u64 layoutHash; // Hash of the ranges the program was last indexed with
+	u64 dataHash;   // Hash of the program's data over those ranges
+	u64 headHash;   // Hash of the first of those ranges, to skip layouts without hashing them all
+	u64 lastUse;    // Search count when the program was last found or created
+	u32 regions;    // Bitmask of the rec-cache regions the program has code in
+	bool indexed;   // Program is in the search index
+	bool cacheHit;  // Program matched one saved in the persistent program cache
+	bool stale;     // Ranges have changed since the program was indexed
 };
 
 typedef std::deque<microProgram*> microProgramList;
 
+// Programs sharing a start PC, grouped by the ranges they have compiled. Searching hashes
+// micro memory once per group instead of comparing it against every program.
+struct microProgIndex
+{
+	struct Layout
+	{
+		std::vector<microRange> ranges;
+		std::unordered_multimap<u64, microProgram*> progs; // by data hash
+		std::unordered_multiset<u64> heads;                // head hash of each program
+	};
+
+	std::unordered_map<u64, Layout> layouts[mProgSize / 2]; // by start PC, then layout hash
+	std::vector<microProgram*> stale; // Programs to (re)index before the next search
+	std::vector<microProgram*> warming; // Programs with saved entry points still to be precompiled
+	std::unordered_map<u64, u64> rangeHashes; // Range hashes (by start/end) already worked out in this search
+};
+
+struct microProgStats
+{
+	u64 searches; // Searches for a program
+	u64 probes;   // Layouts hashed and looked up
+	u64 compares; // Full compares against micro memory
+	u64 hits;     // Searches which found a program
+};
+
+struct microCacheStats
+{
+	u64 retired;  // Rec-cache regions retired to make room
+	u64 progs;    // Programs thrown away with them
+	u64 bytes;    // Bytes of code thrown away with them
+	u64 flushes;  // Times the whole rec-cache was thrown away
+	u64 start;    // Timer value the counts start from
+};
+
 struct microProgramQuick
 {
 	microBlockManager* block; // Quick reference to valid microBlockManager for current startPC
 	microProgram*      prog;  // The microProgram who is the owner of 'block'
 };
 
+// The rec-cache is split into regions which are filled in turn. When the last one fills up,
+// the oldest is retired along with every program which has code in it, rather than
+// throwing the whole cache away.
+static const uint mVUcacheRegions = 4;
+
 struct microProgManager
 {
 	microIR<mProgSize> IRinfo;             // IR information
 	microProgramList*  prog [mProgSize/2]; // List of microPrograms indexed by startPC values
 	microProgramQuick  quick[mProgSize/2]; // Quick reference to valid microPrograms for current execution
+	microProgIndex*    index;              // Search index over prog
+	microProgStats     stats;              // Search counters
 	microProgram*      cur;                // Pointer to currently running MicroProgram
 	int                total;              // Total Number of valid MicroPrograms
 	int                isSame;             // Current cached microProgram is Exact Same program as vuRegs[mVU.index].Micro (-1 = unknown, 0 = No, 1 = Yes)
@@ -82,13 +142,17 @@ struct microProgManager
 	u32                curFrame;           // Frame Counter
 	u8*                x86ptr;             // Pointer to program's recompilation code
 	u8*                x86start;           // Start of program's rec-cache
-	u8*                x86end;             // Limit of program's rec-cache
+	u8*                x86end;             // Limit of the region being written to (leaves a safe-zone before the next)
+	u32                region;             // Rec-cache region being written to
+	u8*                regionEnd[mVUcacheRegions]; // How far each region was filled
+	microCacheStats    cacheStats;         // Rec-cache eviction counters
 	microRegInfo       lpState;            // Pipeline state from where program left off (useful for continuing execution)
 };
 
 static const uint mVUdispCacheSize = __pagesize; // Dispatcher Cache Size (in bytes)
 static const uint mVUcacheSafeZone =  3; // Safe-Zone for program recompilation (in megabytes)
 static const uint mVUcacheReserve = 64; // mVU0, mVU1 Reserve Cache Size (in megabytes)
+static_assert(mVUcacheReserve / mVUcacheRegions > mVUcacheSafeZone, "Rec-cache regions must be larger than the safe-zone");
 
 struct microVU
 {
@@ -149,6 +213,25 @@ public:
 		fBlockEnd = fBlockList = nullptr;
 	}
 	~microBlockManager() { reset(); }
+	// Forgets JR/JALR targets cached for programs which are being thrown away
+	template <typename Pred>
+	void clearJumpCache(Pred&& isGone)
+	{
+		for (microBlockLink* list : {qBlockList, fBlockList})
+		{
+			for (microBlockLink* linkI = list; linkI != nullptr; linkI = linkI->next)
+			{
+				if (!linkI->block.jumpCache)
+					continue;
+				for (u32 i = 0; i < mProgSize / 2; i++)
+				{
+					microJumpCache& jc = linkI->block.jumpCache[i];
+					if (jc.prog && isGone(jc.prog))
+						jc = microJumpCache();
+				}
+			}
+		}
+	}
 	void reset()
 	{
 		for (microBlockLink* linkI = qBlockList; linkI != nullptr;)
@@ -254,7 +337,16 @@ mVUop(mVUopL);
 // Private Functions
 extern void mVUcacheProg(microVU& mVU, microProgram& prog);
 extern void mVUdeleteProg(microVU& mVU, microProgram*& prog);
+extern void mVUprogIndexStale(microVU& mVU, microProgram& prog);
+extern bool mVUcmpProg(microVU& mVU, microProgram& prog);
+extern void mVUprogLogStats(microVU& mVU);
+extern void mVUretireRegion(microVU& mVU);
+extern void mVUcacheLogStats(microVU& mVU);
 _mVUt extern void* mVUsearchProg(u32 startPC, uptr pState);
+extern void mVUdiskCacheAddEntry(microVU& mVU, u32 startPC, uptr pState);
+extern void mVUdiskCacheWarm(microVU& mVU, microProgram& prog);
+extern void mVUdiskCacheStore(microVU& mVU, bool save);
+extern void mVUdiskCacheStoreProg(microVU& mVU, const microProgram& prog);
 extern void* mVUexecuteVU0(u32 startPC, u32 cycles);
 extern void* mVUexecuteVU1(u32 startPC, u32 cycles);
 
@@ -273,5 +365,6 @@ typedef void (*mVUrecCallXG)(void);
 #include "microVU_Flags.inl"
 #include "microVU_Branch.inl"
 #include "microVU_Compile.inl"
+#include "microVU_ProgCache.inl"
 #include "microVU_Execute.inl"
 #include "microVU_Macro.inl"
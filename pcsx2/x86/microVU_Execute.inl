@@ -336,8 +336,13 @@ _mVUt void mVUcleanUp(void)
 
 	mVU.prog.x86ptr = xGetAlignedCallTarget();
 
-	if ((xGetPtr() < mVU.prog.x86start) || (xGetPtr() >= mVU.prog.x86end))
+	if ((xGetPtr() < mVU.prog.x86start) || (xGetPtr() >= mVU.prog.x86start + mVU.cacheSize * _1mb))
+	{
+		mVU.prog.cacheStats.flushes++;
 		mVUreset(mVU, false);
+	}
+	else if (xGetPtr() >= mVU.prog.x86end)
+		mVUretireRegion(mVU);
 
 	mVU.cycles = mVU.totalCycles - std::max(0, mVU.cycles);
 	vuRegs[mVU.index].cycle += mVU.cycles;
@@ -315,6 +315,12 @@ static constexpr bool doWholeProgCompare = false;
 // Compares the entire VU memory with the stored micro program's memory, regardless of if it's used.
 // Generally slower but may be useful for debugging.
 
+// Persistent program cache
+static constexpr bool doProgCache = true;
+// Saves the entry points each microProgram compiled, per game, and precompiles them
+// while the VU is idle when the same program is seen again in a later session. Only
+// the entry points are saved, so everything is still recompiled, just ahead of time.
+
 //------------------------------------------------------------------
 // Speed Hacks (can cause infinite loops, SPS, Black Screens, etc...)
 //------------------------------------------------------------------
@@ -0,0 +1,458 @@
+/*  PCSX2 - PS2 Emulator for PCs
+ *  Copyright (C) 2002-2023 PCSX2 Dev Team
+ *
+ *  PCSX2 is free software: you can redistribute it and/or modify it under the terms
+ *  of the GNU Lesser General Public License as published by the Free Software Found-
+ *  ation, either version 3 of the License, or (at your option) any later version.
+ *
+ *  PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ *  without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ *  PURPOSE.  See the GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License along with PCSX2.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "common/Console.h"
+#include "common/FileSystem.h"
+#include "common/Path.h"
+#include "common/StringUtil.h"
+
+#ifndef XXH_versionNumber
+	#define XXH_STATIC_LINKING_ONLY 1
+	#define XXH_INLINE_ALL 1
+	#include <xxhash.h>
+#endif
+
+//------------------------------------------------------------------
+// Persistent Program Cache
+//------------------------------------------------------------------
+// This is a prefetch list, not a code cache: generated code embeds absolute addresses, so it
+// can't be saved, and neither is the decoded program. Every entry is still fully recompiled
+// on a warm start. What is saved per game is only the list of entry points (start PC +
+// pipeline state) each program ended up needing, keyed by a hash of the program's compiled
+// ranges. When a new program matches a saved one, its entry points are queued, and compiled
+// in the order they were first needed while the VU isn't running: on the VM thread between
+// frames, and on the MTVU thread while its ring is empty. This saves the recompiler no work,
+// it only moves it off the path execution is waiting on; the "compiled on demand" count in
+// the log says how many entry points it didn't get to in time.
+
+static constexpr u32 mVUdiskCacheMagic      = 0x4355564D; // 'MVUC'
+static constexpr u32 mVUdiskCacheVersion    = 1;
+static constexpr u32 mVUdiskCacheMaxSize    = 8 * _1mb; // Per game, least recently used programs are dropped past this
+static constexpr u32 mVUdiskCacheMaxEntries = 512;      // Per program
+static constexpr u32 mVUdiskCacheWarmBatch  = 16;       // Entry points precompiled per VU between frames
+
+#pragma pack(push, 1)
+struct mVUdiskCacheHeader
+{
+	u32 magic;
+	u32 version;
+	u32 entrySize;   // sizeof(microCacheEntry), so layout changes invalidate the file
+	u32 session;     // Bumped every time the file is loaded, used for LRU eviction
+	u32 recordCount; // followed by the records
+};
+
+struct mVUdiskCacheRecordHeader
+{
+	u32 vuIndex;
+	u32 startPC; // Program list index (start_pc / 8)
+	u64 hash;    // Hash of the micro memory covered by the ranges
+	u64 config;  // Hash of the settings that affect compilation
+	u32 session; // Session the program was last used in
+	u32 rangeCount;
+	u32 entryCount; // followed by rangeCount microRanges, then entryCount microCacheEntries
+};
+#pragma pack(pop)
+
+struct mVUdiskCacheRecord
+{
+	mVUdiskCacheRecordHeader header;
+	std::vector<microRange> ranges;
+	std::vector<microCacheEntry> entries;
+};
+
+struct mVUdiskCacheStats
+{
+	u32 hits;     // New programs which matched a saved one
+	u32 misses;   // New programs which didn't
+	u32 warmed;   // Entry points compiled ahead of time
+	u32 cold;     // Entry points of matched programs which still had to be compiled on demand
+	u32 stored;   // Programs written on the last save
+	u32 evicted;  // Programs dropped by the size cap on the last save
+};
+
+static std::mutex s_diskCacheMutex;
+static std::string s_diskCachePath; // Empty when no game is loaded
+static std::unordered_map<u32, std::vector<mVUdiskCacheRecord>> s_diskCacheRecords; // vuIndex << 16 | startPC
+static u32 s_diskCacheSession = 0;
+static bool s_diskCacheDirty = false;
+static mVUdiskCacheStats s_diskCacheStats = {};
+static thread_local bool s_diskCacheWarming = false;
+
+static u64 mVUdiskCacheConfig()
+{
+	// Clamping modes, gamefixes and the flag hack all change what gets compiled.
+	u64 hash = XXH3_64bits(&EmuConfig.Cpu.Recompiler.bitset, sizeof(EmuConfig.Cpu.Recompiler.bitset));
+	hash = XXH3_64bits_withSeed(&EmuConfig.Gamefixes.bitset, sizeof(EmuConfig.Gamefixes.bitset), hash);
+	hash = XXH3_64bits_withSeed(&EmuConfig.Speedhacks.bitset, sizeof(EmuConfig.Speedhacks.bitset), hash);
+	return hash;
+}
+
+static bool mVUdiskCacheValidRange(const microVU& mVU, const microRange& range)
+{
+	return (range.start >= 0 && range.end > range.start && static_cast<u32>(range.end) <= mVU.microMemSize);
+}
+
+template <typename Ranges>
+static u64 mVUdiskCacheHash(const u8* data, const Ranges& ranges)
+{
+	u64 hash = 0;
+	for (const microRange& range : ranges)
+		hash = XXH3_64bits_withSeed(data + range.start, range.end - range.start, hash);
+	return hash;
+}
+
+static void mVUdiskCacheWrite()
+{
+	if (s_diskCachePath.empty() || !s_diskCacheDirty)
+		return;
+
+	std::vector<const mVUdiskCacheRecord*> records;
+	for (const auto& it : s_diskCacheRecords)
+	{
+		for (const mVUdiskCacheRecord& record : it.second)
+			records.push_back(&record);
+	}
+	std::sort(records.begin(), records.end(), [](const mVUdiskCacheRecord* a, const mVUdiskCacheRecord* b) {
+		return a->header.session > b->header.session;
+	});
+
+	std::vector<u8> data(sizeof(mVUdiskCacheHeader));
+	u32 stored = 0;
+	for (const mVUdiskCacheRecord* record : records)
+	{
+		const size_t rangeBytes = record->ranges.size() * sizeof(microRange);
+		const size_t entryBytes = record->entries.size() * sizeof(microCacheEntry);
+		const size_t size = sizeof(mVUdiskCacheRecordHeader) + rangeBytes + entryBytes;
+		if (data.size() + size > mVUdiskCacheMaxSize)
+			break;
+
+		const size_t pos = data.size();
+		data.resize(pos + size);
+		std::memcpy(&data[pos], &record->header, sizeof(mVUdiskCacheRecordHeader));
+		std::memcpy(&data[pos + sizeof(mVUdiskCacheRecordHeader)], record->ranges.data(), rangeBytes);
+		std::memcpy(&data[pos + sizeof(mVUdiskCacheRecordHeader) + rangeBytes], record->entries.data(), entryBytes);
+		stored++;
+	}
+
+	mVUdiskCacheHeader header;
+	header.magic       = mVUdiskCacheMagic;
+	header.version     = mVUdiskCacheVersion;
+	header.entrySize   = sizeof(microCacheEntry);
+	header.session     = s_diskCacheSession;
+	header.recordCount = stored;
+	std::memcpy(data.data(), &header, sizeof(header));
+
+	if (!FileSystem::WriteBinaryFile(s_diskCachePath.c_str(), data.data(), data.size()))
+	{
+		Console.Error("(mVU) Failed to write program cache '%s'", s_diskCachePath.c_str());
+		return;
+	}
+
+	s_diskCacheDirty          = false;
+	s_diskCacheStats.stored   = stored;
+	s_diskCacheStats.evicted  = static_cast<u32>(records.size()) - stored;
+	Console.WriteLn("(mVU) Program cache: %u hits, %u misses, %u entry points precompiled, %u compiled on demand, "
+					"%u programs saved, %u dropped",
+		s_diskCacheStats.hits, s_diskCacheStats.misses, s_diskCacheStats.warmed, s_diskCacheStats.cold,
+		s_diskCacheStats.stored, s_diskCacheStats.evicted);
+}
+
+static void mVUdiskCacheLoad()
+{
+	s_diskCacheSession = 1;
+
+	std::optional<std::vector<u8>> data = FileSystem::ReadBinaryFile(s_diskCachePath.c_str());
+	if (!data.has_value())
+		return;
+
+	const u8* ptr = data->data();
+	const u8* end = ptr + data->size();
+
+	mVUdiskCacheHeader header;
+	if (data->size() < sizeof(header))
+		return;
+	std::memcpy(&header, ptr, sizeof(header));
+	ptr += sizeof(header);
+
+	if (header.magic != mVUdiskCacheMagic || header.version != mVUdiskCacheVersion || header.entrySize != sizeof(microCacheEntry))
+	{
+		Console.Warning("(mVU) Discarding incompatible program cache '%s'", s_diskCachePath.c_str());
+		return;
+	}
+
+	for (u32 i = 0; i < header.recordCount; i++)
+	{
+		mVUdiskCacheRecord record;
+		if (static_cast<size_t>(end - ptr) < sizeof(record.header))
+			break;
+		std::memcpy(&record.header, ptr, sizeof(record.header));
+		ptr += sizeof(record.header);
+
+		const size_t rangeBytes = static_cast<size_t>(record.header.rangeCount) * sizeof(microRange);
+		const size_t entryBytes = static_cast<size_t>(record.header.entryCount) * sizeof(microCacheEntry);
+		if (record.header.vuIndex > 1 || record.header.entryCount > mVUdiskCacheMaxEntries ||
+			static_cast<size_t>(end - ptr) < rangeBytes + entryBytes)
+			break;
+
+		record.ranges.resize(record.header.rangeCount);
+		std::memcpy(record.ranges.data(), ptr, rangeBytes);
+		ptr += rangeBytes;
+		record.entries.resize(record.header.entryCount);
+		std::memcpy(record.entries.data(), ptr, entryBytes);
+		ptr += entryBytes;
+
+		const microVU& mVU = record.header.vuIndex ? microVU1 : microVU0;
+		const bool valid = std::all_of(record.ranges.begin(), record.ranges.end(),
+			[&mVU](const microRange& range) { return mVUdiskCacheValidRange(mVU, range); });
+		if (!valid || record.ranges.empty() || record.header.startPC >= (mVU.progSize / 2))
+			continue;
+
+		s_diskCacheRecords[(record.header.vuIndex << 16) | record.header.startPC].push_back(std::move(record));
+	}
+
+	s_diskCacheSession = header.session + 1;
+}
+
+// Switches to the cache of the game which is running now, saving the previous one.
+// s_diskCacheMutex must be held.
+static void mVUdiskCacheOpen(const std::string& serial)
+{
+	const std::string path = serial.empty() ? std::string() :
+		Path::Combine(EmuFolders::Cache, StringUtil::StdStringFromFormat("vu_programs_%s.bin", serial.c_str()));
+	if (path == s_diskCachePath)
+		return;
+
+	mVUdiskCacheWrite();
+	s_diskCacheRecords.clear();
+	s_diskCacheDirty = false;
+	s_diskCacheStats = {};
+	s_diskCachePath  = path;
+
+	if (!s_diskCachePath.empty())
+		mVUdiskCacheLoad();
+}
+
+// Called from the VM thread when the running game changes, so the VU threads never have
+// to ask which game they are running.
+void mVUdiskCacheSetGame(const std::string& serial)
+{
+	std::unique_lock lock(s_diskCacheMutex);
+	mVUdiskCacheOpen(serial);
+}
+
+// Remembers an entry point the current program had to compile.
+__fi void mVUdiskCacheAddEntry(microVU& mVU, u32 startPC, uptr pState)
+{
+	if (mVU.prog.cur->cacheHit && !s_diskCacheWarming)
+	{
+		std::unique_lock lock(s_diskCacheMutex);
+		s_diskCacheStats.cold++;
+	}
+
+	std::vector<microCacheEntry>& entries = *mVU.prog.cur->cacheEntries;
+	if (entries.size() >= mVUdiskCacheMaxEntries)
+		return;
+
+	microCacheEntry& entry = entries.emplace_back();
+	std::memcpy(&entry.pState, reinterpret_cast<const microRegInfo*>(pState), sizeof(microRegInfo));
+	entry.startPC = startPC;
+}
+
+// Precompiles up to maxEntries saved entry points of the programs queued by mVUdiskCacheWarm().
+// Only call this from the thread which runs the VU while it isn't executing. Returns true if it
+// got some done and more are still queued.
+bool mVUdiskCacheWarmIdle(u32 vuIndex, u32 maxEntries)
+{
+	microVU& mVU = vuIndex ? microVU1 : microVU0;
+	if (!doProgCache || !mVU.prog.index || mVU.prog.index->warming.empty())
+		return false;
+
+	std::vector<microProgram*>& warming = mVU.prog.index->warming;
+	microProgram* const cur = mVU.prog.cur;
+	const int isSame = mVU.prog.isSame;
+	u32 warmed = 0;
+
+	xSetPtr(mVU.prog.x86ptr);
+	s_diskCacheWarming = true;
+	for (size_t i = 0; i < warming.size() && warmed < maxEntries && xGetPtr() < mVU.prog.x86end;)
+	{
+		microProgram& prog = *warming[i];
+
+		// Compiling reads micro memory, so wait until the program is back in it.
+		if (!mVUcmpProg(mVU, prog))
+		{
+			i++;
+			continue;
+		}
+
+		mVU.prog.cur    = &prog;
+		mVU.prog.isSame = -1;
+
+		// Stored back to front, so the first one needed last time comes first. Stop
+		// short of the safe zone, it's for the blocks that are actually about to run.
+		std::vector<microCacheEntry>& entries = *prog.warmEntries;
+		while (!entries.empty() && warmed < maxEntries && xGetPtr() < mVU.prog.x86end)
+		{
+			microCacheEntry entry = entries.back();
+			entries.pop_back();
+			mVUblockFetch(mVU, entry.startPC, reinterpret_cast<uptr>(&entry.pState));
+			warmed++;
+		}
+
+		if (entries.empty())
+		{
+			delete prog.warmEntries;
+			prog.warmEntries = nullptr;
+			warming.erase(warming.begin() + i);
+		}
+		else
+			i++;
+	}
+	s_diskCacheWarming = false;
+
+	mVU.prog.cur    = cur;
+	mVU.prog.isSame = isSame;
+	mVU.prog.x86ptr = xGetAlignedCallTarget();
+
+	if (warmed > 0)
+	{
+		std::unique_lock lock(s_diskCacheMutex);
+		s_diskCacheStats.warmed += warmed;
+	}
+	return (warmed > 0 && !warming.empty());
+}
+
+// Called by the VM thread between frames, for the VUs it runs.
+void mVUdiskCacheWarmFrame()
+{
+	if (EmuConfig.Cpu.Recompiler.EnableVU0)
+		mVUdiskCacheWarmIdle(0, mVUdiskCacheWarmBatch);
+	if (EmuConfig.Cpu.Recompiler.EnableVU1 && !THREAD_VU1)
+		mVUdiskCacheWarmIdle(1, mVUdiskCacheWarmBatch);
+}
+
+// Called once a new program has compiled its first block. If the micro memory matches a
+// saved program, queues the entry points that program needed last time for mVUdiskCacheWarmIdle().
+void mVUdiskCacheWarm(microVU& mVU, microProgram& prog)
+{
+	std::vector<microCacheEntry> entries;
+	{
+		std::unique_lock lock(s_diskCacheMutex);
+		if (s_diskCachePath.empty())
+			return;
+
+		const u64 config = mVUdiskCacheConfig();
+		const u8* micro = vuRegs[mVU.index].Micro;
+		const auto it = s_diskCacheRecords.find((mVU.index << 16) | prog.startPC);
+		if (it != s_diskCacheRecords.end())
+		{
+			for (mVUdiskCacheRecord& record : it->second)
+			{
+				if (record.header.config != config || record.header.hash != mVUdiskCacheHash(micro, record.ranges))
+					continue;
+
+				record.header.session = s_diskCacheSession;
+				entries = record.entries;
+				break;
+			}
+		}
+
+		if (entries.empty())
+		{
+			s_diskCacheStats.misses++;
+			return;
+		}
+		s_diskCacheStats.hits++;
+	}
+
+	std::reverse(entries.begin(), entries.end());
+	prog.cacheHit    = true;
+	prog.warmEntries = new std::vector<microCacheEntry>(std::move(entries));
+	mVU.prog.index->warming.push_back(&prog);
+}
+
+// Adds a program to the cache (s_diskCacheMutex must be held).
+static void mVUdiskCacheRecordProg(microVU& mVU, const microProgram& prog, u64 config)
+{
+	if (prog.cacheEntries->empty())
+		return;
+
+	mVUdiskCacheRecord record = {};
+	for (const microRange& range : *prog.ranges)
+	{
+		if (mVUdiskCacheValidRange(mVU, range))
+			record.ranges.push_back(range);
+	}
+	if (record.ranges.empty())
+		return;
+
+	record.header.vuIndex = mVU.index;
+	record.header.startPC = prog.startPC;
+	record.header.hash    = mVUdiskCacheHash(reinterpret_cast<const u8*>(prog.data), record.ranges);
+	record.header.config  = config;
+	record.header.session = s_diskCacheSession;
+	record.entries        = *prog.cacheEntries;
+	record.header.rangeCount = static_cast<u32>(record.ranges.size());
+	record.header.entryCount = static_cast<u32>(record.entries.size());
+
+	std::vector<mVUdiskCacheRecord>& list = s_diskCacheRecords[(mVU.index << 16) | prog.startPC];
+	auto existing = std::find_if(list.begin(), list.end(), [&record](const mVUdiskCacheRecord& r) {
+		return (r.header.hash == record.header.hash && r.header.config == record.header.config);
+	});
+	if (existing == list.end())
+		list.push_back(std::move(record));
+	else if (existing->entries.size() <= record.entries.size())
+		*existing = std::move(record);
+	else
+		existing->header.session = s_diskCacheSession;
+
+	s_diskCacheDirty = true;
+}
+
+// Adds the programs of a VU to the cache before they are thrown away.
+void mVUdiskCacheStore(microVU& mVU, bool save)
+{
+	std::unique_lock lock(s_diskCacheMutex);
+	if (s_diskCachePath.empty())
+		return;
+
+	const u64 config = mVUdiskCacheConfig();
+	for (u32 i = 0; i < (mVU.progSize / 2); i++)
+	{
+		if (!mVU.prog.prog[i])
+			continue;
+
+		for (microProgram* prog : *mVU.prog.prog[i])
+			mVUdiskCacheRecordProg(mVU, *prog, config);
+	}
+
+	if (save)
+		mVUdiskCacheWrite();
+}
+
+// Adds a single program to the cache before it is thrown away.
+void mVUdiskCacheStoreProg(microVU& mVU, const microProgram& prog)
+{
+	std::unique_lock lock(s_diskCacheMutex);
+	if (s_diskCachePath.empty())
+		return;
+
+	mVUdiskCacheRecordProg(mVU, prog, mVUdiskCacheConfig());
+}
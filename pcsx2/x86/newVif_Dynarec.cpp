@@ -17,6 +17,8 @@
 // authors: cottonvibes(@gmail.com)
 //			Jake.Stine (@gmail.com)
 
+#include "../../common/Console.h"
+
 #include "newVif_UnpackSSE.h"
 #include "../MTVU.h"
 
@@ -31,9 +33,45 @@ void dVifReserve(int idx)
 	nVif[idx].recReserve->Assign(GetVmMemory().CodeMemory(), offset, 8 * _1mb);
 }
 
+static void dVifLogStats(int idx)
+{
+	const nVifStats stats = dVifGetStats(idx);
+	if (stats.lookups == 0)
+		return;
+
+	Console.WriteLn("(VIF%d) Unpack cache: %llu lookups, %llu compiles (%.2f%% hit), %u blocks in %u buckets, "
+					"%.2f probes/lookup (max %u), %llu KB of code",
+		idx, static_cast<unsigned long long>(stats.lookups), static_cast<unsigned long long>(stats.compiles),
+		100.0 * (stats.lookups - stats.compiles) / stats.lookups,
+		stats.blocks, stats.buckets, static_cast<double>(stats.probes) / stats.lookups, stats.maxProbe,
+		static_cast<unsigned long long>(stats.codeBytes / 1024));
+}
+
+nVifStats dVifGetStats(int idx, bool reset)
+{
+	const HashBucket::Stats blocks = nVif[idx].vifBlocks.getStats();
+
+	nVifStats stats;
+	stats.lookups = blocks.lookups;
+	stats.compiles = blocks.misses;
+	stats.probes = blocks.probes;
+	stats.maxProbe = blocks.maxProbe;
+	stats.blocks = blocks.blocks;
+	stats.buckets = blocks.buckets;
+	stats.codeBytes = nVif[idx].codeBytes;
+
+	if (reset)
+		nVif[idx].vifBlocks.resetStats();
+
+	return stats;
+}
+
 void dVifReset(int idx)
 {
+	dVifLogStats(idx);
+
 	nVif[idx].vifBlocks.reset();
+	nVif[idx].codeBytes = 0;
 
 	nVif[idx].recReserve->Reset();
 
@@ -42,6 +80,10 @@ void dVifReset(int idx)
 
 void dVifRelease(int idx)
 {
+	dVifLogStats(idx);
+	nVif[idx].vifBlocks.clear();
+	nVif[idx].codeBytes = 0;
+
 	if (nVif[idx].recReserve)
 		nVif[idx].recReserve->Reset();
 	delete nVif[idx].recReserve;
@@ -310,7 +352,7 @@ static u16 dVifComputeLength(uint cl, uint wl, u8 num, bool isFill)
 	return std::min(length, 0xFFFFu);
 }
 
-_vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
+_vifT __fi void dVifCompile(nVifBlock& block, bool isFill)
 {
 	nVifStruct& v = nVif[idx];
 
@@ -322,9 +364,8 @@ _vifT __fi nVifBlock* dVifCompile(nVifBlock& block, bool isFill)
 	v.vifBlocks.add(block);
 
 	VifUnpackSSE_Dynarec(v, block).CompileRoutine();
+	v.codeBytes += xGetPtr() - v.recWritePtr;
 	v.recWritePtr = xGetPtr();
-
-	return &block;
 }
 
 _vifT __fi void dVifUnpack(const u8* data, bool isFill)
@@ -359,9 +400,8 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 	block.key1 = key1;
 
 	// Seach in cache before trying to compile the block
-	nVifBlock* b = v.vifBlocks.find(block);
-	if (unlikely(b == nullptr))
-		b = dVifCompile<idx>(block, isFill);
+	if (unlikely(!v.vifBlocks.find(block)))
+		dVifCompile<idx>(block, isFill);
 
 	{ // Execute the block
 		const VURegs& VU = vuRegs[idx];
@@ -371,8 +411,8 @@ _vifT __fi void dVifUnpack(const u8* data, bool isFill)
 		u8* endmem   = VU.Mem + vuMemLimit;
 
 		// No wrapping, you can run the fast dynarec
-		if (likely((startmem + b->length) <= endmem))
-			((nVifrecCall)b->startPtr)((uptr)startmem, (uptr)data);
+		if (likely((startmem + block.length) <= endmem))
+			((nVifrecCall)block.startPtr)((uptr)startmem, (uptr)data);
 		else
 			_nVifUnpack(idx, data, vifRegs.mode, isFill);
 	}
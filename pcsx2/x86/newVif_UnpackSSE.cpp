@@ -15,9 +15,6 @@
 
 #include "newVif_UnpackSSE.h"
 
-//alignas(__pagesize) static u8 nVifUpkExec[__pagesize*4];
-static RecompiledCodeReserve* nVifUpkExec = NULL;
-
 // =====================================================================================================
 //  VifUnpackSSE_Base Section
 // =====================================================================================================
@@ -297,67 +294,3 @@ void VifUnpackSSE_Base::xUnpack(int upknum) const
 			break;
 	}
 }
-
-// =====================================================================================================
-//  VifUnpackSSE_Simple
-// =====================================================================================================
-
-void VifUnpackSSE_Simple::doMaskWrite(const xRegisterSSE& regX) const
-{
-	xMOVAPS(xmm7, ptr[dstIndirect]);
-	int offX = std::min(curCycle, 3);
-	xPAND(regX, ptr32[nVifMask[0][offX]]);
-	xPAND(xmm7, ptr32[nVifMask[1][offX]]);
-	xPOR (regX, ptr32[nVifMask[2][offX]]);
-	xPOR (regX, xmm7);
-	xMOVAPS(ptr[dstIndirect], regX);
-}
-
-// ecx = dest, edx = src
-static void nVifGen(int usn, int mask, int curCycle)
-{
-	VifUnpackSSE_Simple vpugen;
-	int usnpart      = usn * 2 * 16;
-	int maskpart     = mask * 16;
-
-	vpugen.usn       = !!usn;
-	vpugen.doMask    = !!mask;
-	vpugen.curCycle  = curCycle;
-	vpugen.IsAligned = true;
-
-	for (int i = 0; i < 16; ++i)
-	{
-		nVifCall& ucall(nVifUpk[((usnpart + maskpart + i) * 4) + curCycle]);
-		ucall = NULL;
-		if (nVifT[i] == 0)
-			continue;
-
-		ucall = (nVifCall)xGetAlignedCallTarget();
-		vpugen.xUnpack(i);
-		vpugen.xMovDest();
-		xRET();
-	}
-}
-
-void VifUnpackSSE_Init(void)
-{
-	if (nVifUpkExec)
-		return;
-
-	nVifUpkExec = new RecompiledCodeReserve();
-	nVifUpkExec->Assign(GetVmMemory().CodeMemory(), HostMemoryMap::VIFUnpackRecOffset, _1mb);
-	xSetPtr(*nVifUpkExec);
-
-	for (int a = 0; a < 2; a++)
-		for (int b = 0; b < 2; b++)
-			for (int c = 0; c < 4; c++)
-				nVifGen(a, b, c);
-
-	nVifUpkExec->ForbidModification();
-}
-
-void VifUnpackSSE_Destroy(void)
-{
-	delete nVifUpkExec;
-	nVifUpkExec = NULL;
-}
@@ -71,28 +71,6 @@ protected:
 	virtual void xUPK_V4_5() const;
 };
 
-// --------------------------------------------------------------------------------------
-//  VifUnpackSSE_Simple
-// --------------------------------------------------------------------------------------
-class VifUnpackSSE_Simple : public VifUnpackSSE_Base
-{
-	typedef VifUnpackSSE_Base _parent;
-
-public:
-	int curCycle;
-
-public:
-	VifUnpackSSE_Simple() = default;
-	virtual ~VifUnpackSSE_Simple() = default;
-
-	virtual bool IsWriteProtectedOp() const { return false; }
-	virtual bool IsInputMasked() const { return false; }
-	virtual bool IsUnmaskedOp() const { return !doMask; }
-
-protected:
-	virtual void doMaskWrite(const xRegisterSSE& regX) const;
-};
-
 // --------------------------------------------------------------------------------------
 //  VifUnpackSSE_Dynarec
 // --------------------------------------------------------------------------------------
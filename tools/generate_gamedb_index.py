@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+# PCSX2 - PS2 Emulator for PCs
+# Copyright (C) 2002-2023  PCSX2 Dev Team
+#
+# PCSX2 is free software: you can redistribute it and/or modify it under the terms
+# of the GNU Lesser General Public License as published by the Free Software Found-
+# ation, either version 3 of the License, or (at your option) any later version.
+#
+# PCSX2 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+# without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+# PURPOSE.  See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with PCSX2.
+# If not, see <http://www.gnu.org/licenses/>.
+
+# Compiles GameIndex.yaml into GameIndex.bin, which GameDatabase.cpp uses instead of parsing
+# the whole YAML file at startup.
+#
+# Layout (all integers are little-endian u32):
+#   header:  magic 'GDBI', version, yaml size, yaml crc32, entry count,
+#            entries offset, strings offset, records offset
+#   entries: serial offset, serial length, record offset, record length
+#            sorted by lower-case serial
+#   strings: lower-case serials
+#   records: the YAML text of each entry, including its key line
+#
+# Entries are split on top-level keys rather than with a YAML parser, so no extra modules are
+# needed. Anything at column 0 that isn't a key, comment or blank line is rejected.
+
+# pylint: disable=missing-function-docstring
+
+MAGIC = 0x49424447
+VERSION = 1
+HEADER = struct.Struct("<8I")
+ENTRY = struct.Struct("<4I")
+
+src_file = os.path.join(os.path.dirname(__file__), "..", "bin", "resources", "GameIndex.yaml")
+dst_file = os.path.join(os.path.dirname(__file__), "..", "bin", "resources", "GameIndex.bin")
+
+key_re = re.compile(rb"^([A-Za-z0-9_-]+):\s*(#.*)?$")
+
+
+def split_entries(data):
+    entries = []
+    serial = None
+    lines = []
+
+    def finish():
+        # Drop the comments and blank lines between this entry and the next one.
+        while lines and (not lines[-1].strip() or lines[-1].lstrip().startswith(b"#")):
+            lines.pop()
+        if serial is not None:
+            entries.append((serial, b"\n".join(lines) + b"\n"))
+
+    for lineno, line in enumerate(data.split(b"\n"), 1):
+        line = line.rstrip(b"\r")
+        if line[:1] in (b" ", b"\t") or not line.strip() or line.startswith(b"#"):
+            if serial is not None:
+                lines.append(line)
+            continue
+
+        match = key_re.match(line)
+        if not match:
+            sys.exit("%s:%d: unexpected top-level line: %s" % (src_file, lineno, line.decode("utf-8", "replace")))
+
+        finish()
+        serial = match.group(1)
+        lines = [line]
+
+    finish()
+    return entries
+
+
+def main():
+    global src_file, dst_file
+    if len(sys.argv) > 1:
+        src_file = sys.argv[1]
+    if len(sys.argv) > 2:
+        dst_file = sys.argv[2]
+
+    with open(src_file, "rb") as f:
+        data = f.read()
+
+    # Serials are case-insensitive, and the first occurrence wins, same as the YAML loader.
+    records = {}
+    for serial, record in split_entries(data):
+        key = serial.lower()
+        if key in records:
+            print("Duplicate serial '%s' found in GameDB, skipping" % serial.decode(), file=sys.stderr)
+            continue
+        records[key] = record
+
+    serials = sorted(records.keys())
+    entries_offset = HEADER.size
+    strings_offset = entries_offset + ENTRY.size * len(serials)
+    strings = bytearray()
+    blob = bytearray()
+    entries = bytearray()
+    for serial in serials:
+        entries += ENTRY.pack(len(strings), len(serial), len(blob), len(records[serial]))
+        strings += serial
+        blob += records[serial]
+
+    records_offset = strings_offset + len(strings)
+    header = HEADER.pack(MAGIC, VERSION, len(data), zlib.crc32(data) & 0xFFFFFFFF, len(serials),
+        entries_offset, strings_offset, records_offset)
+
+    with open(dst_file, "wb") as f:
+        f.write(header)
+        f.write(entries)
+        f.write(strings)
+        f.write(blob)
+
+    print("Wrote %d entries to %s" % (len(serials), dst_file))
+
+
+if __name__ == "__main__":
+    main()